@@ -0,0 +1,90 @@
+/**
+ * @file        bench_cola_monitoring.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Producer throughput of Cola<int> while a monitor polls its depth.
+ *
+ * @details
+ * A producer pushes while a consumer pops, first with nobody watching,
+ * then with a monitoring thread polling the depth in a tight loop, either
+ * through the wait-free get_size() or through get_stats(), which still
+ * takes the queue mutex (as get_size() used to).
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+
+/* Project libraries */
+
+#include "cola.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr int ITEMS = 1000000;
+constexpr size_t CAPACITY = 1024;
+
+enum class Monitor { NONE, GET_SIZE, GET_STATS };
+
+/**
+ * @brief Push ITEMS elements through a queue with the given monitor running.
+ * @return Nanoseconds per push.
+ */
+double measure(Monitor monitor) {
+    Cola<int> cola(CAPACITY);
+    std::atomic<bool> done(false);
+    size_t polls = 0;
+
+    std::thread consumer([&] {
+        while (!done.load() || !cola.is_empty()) {
+            cola.try_pop();
+        }
+    });
+    std::thread watcher([&] {
+        size_t depth = 0;
+        while (!done.load()) {
+            if (monitor == Monitor::GET_SIZE) {
+                depth += cola.get_size();
+            } else if (monitor == Monitor::GET_STATS) {
+                depth += cola.get_stats().size;
+            } else {
+                break;
+            }
+            ++polls;
+        }
+        polls += depth & 1;  // Keep the reads observable
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITEMS; ++i) {
+        cola.push(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    done.store(true);
+    consumer.join();
+    watcher.join();
+    return std::chrono::duration<double, std::nano>(end - start).count() / ITEMS;
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    const double idle = measure(Monitor::NONE);
+    const double wait_free = measure(Monitor::GET_SIZE);
+    const double locked = measure(Monitor::GET_STATS);
+    std::cerr << "push: no monitor " << idle << " ns, get_size() monitor " << wait_free
+              << " ns, locked monitor " << locked << " ns\n";
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file        bench_cola_producer.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Multi-producer throughput of Cola<T> with and without ColaProducer.
+ *
+ * @details
+ * PRODUCERS threads push ITEMS_PER_PRODUCER elements each while one
+ * consumer drains them with pop_bulk(). Producers either call
+ * Cola<T>::push() per element or go through a ColaProducer<T> with
+ * batches of BATCH elements, which takes the queue lock once per batch.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+#include "cola_producer.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr size_t PRODUCERS = 4;
+constexpr size_t ITEMS_PER_PRODUCER = 500000;
+constexpr size_t BATCH = 64;
+constexpr size_t CAPACITY = PRODUCERS * ITEMS_PER_PRODUCER;
+
+/**
+ * @brief Nanoseconds per element to move every element through the queue.
+ * @param batched Push through a ColaProducer instead of per element.
+ */
+template <typename T>
+double run(bool batched, uint64_t& sink) {
+    Cola<T> cola(CAPACITY);
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&cola, batched] {
+            if (batched) {
+                ColaProducer<T> producer(cola, BATCH);
+                for (size_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                    producer.push(T(i));
+                }
+            } else {
+                for (size_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                    cola.push(T(i));
+                }
+            }
+        });
+    }
+
+    std::vector<T> out(BATCH);
+    size_t received = 0;
+    while (received < PRODUCERS * ITEMS_PER_PRODUCER) {
+        const size_t taken = cola.pop_bulk(out.data(), BATCH, std::chrono::seconds(1));
+        for (size_t i = 0; i < taken; ++i) {
+            sink += static_cast<uint64_t>(out[i]);
+        }
+        received += taken;
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           (PRODUCERS * ITEMS_PER_PRODUCER);
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    uint64_t sink = 0;
+    const double direct = run<uint64_t>(false, sink);
+    const double batched = run<uint64_t>(true, sink);
+    std::cerr << PRODUCERS << " producers: push " << direct << " ns/item, ColaProducer (batch "
+              << BATCH << ") " << batched << " ns/item [" << sink << "]\n";
+    return 0;
+}
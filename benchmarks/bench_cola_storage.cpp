@@ -0,0 +1,150 @@
+/**
+ * @file        bench_cola_storage.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Per-item cost of Cola<T> with ring and generic storage.
+ *
+ * @details
+ * For int and for a 64-byte struct, pushes and pops ITEMS elements
+ * through a single-threaded queue:
+ * - generic: a copy of the type with a user-provided copy constructor,
+ *   which is not trivially copyable and therefore stored in a std::deque,
+ *   popped one by one through nonstd::optional;
+ * - ring: the trivially copyable type, one by one through pop();
+ * - ring bulk: the trivially copyable type with push_bulk() / pop_bulk()
+ *   in batches of BATCH elements.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr size_t ITEMS = 2000000;
+constexpr size_t BATCH = 64;
+constexpr size_t CAPACITY = 1024;
+
+/**
+ * @brief 64-byte trivially copyable payload.
+ */
+struct Payload {
+    uint64_t words[8];
+};
+
+/**
+ * @brief Same data as T, but not trivially copyable.
+ */
+template <typename T>
+struct Generic {
+    T value;
+    Generic() : value() {}
+    explicit Generic(const T& v) : value(v) {}
+    Generic(const Generic& other) : value(other.value) {}
+    Generic& operator=(const Generic& other) {
+        value = other.value;
+        return *this;
+    }
+};
+
+uint64_t checksum(int v) { return static_cast<uint64_t>(v); }
+uint64_t checksum(const Payload& p) { return p.words[0] + p.words[7]; }
+
+int make(size_t i, int*) { return static_cast<int>(i); }
+Payload make(size_t i, Payload*) {
+    Payload p{};
+    p.words[0] = i;
+    p.words[7] = i * 3;
+    return p;
+}
+
+/**
+ * @brief Elapsed nanoseconds per item since start.
+ */
+double per_item(std::chrono::steady_clock::time_point start) {
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / ITEMS;
+}
+
+template <typename T>
+double one_by_one_generic(uint64_t& sink) {
+    Cola<Generic<T>> cola(CAPACITY);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITEMS; i += BATCH) {
+        for (size_t j = 0; j < BATCH; ++j) {
+            cola.push(Generic<T>(make(i + j, static_cast<T*>(nullptr))));
+        }
+        for (size_t j = 0; j < BATCH; ++j) {
+            sink += checksum(cola.pop(std::chrono::seconds(0))->value);
+        }
+    }
+    return per_item(start);
+}
+
+template <typename T>
+double one_by_one_ring(uint64_t& sink) {
+    Cola<T> cola(CAPACITY);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITEMS; i += BATCH) {
+        for (size_t j = 0; j < BATCH; ++j) {
+            cola.push(make(i + j, static_cast<T*>(nullptr)));
+        }
+        for (size_t j = 0; j < BATCH; ++j) {
+            sink += checksum(*cola.pop(std::chrono::seconds(0)));
+        }
+    }
+    return per_item(start);
+}
+
+template <typename T>
+double bulk_ring(uint64_t& sink) {
+    Cola<T> cola(CAPACITY);
+    std::vector<T> in(BATCH);
+    std::vector<T> out(BATCH);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITEMS; i += BATCH) {
+        for (size_t j = 0; j < BATCH; ++j) {
+            in[j] = make(i + j, static_cast<T*>(nullptr));
+        }
+        cola.push_bulk(in.data(), BATCH);
+        const size_t taken = cola.pop_bulk(out.data(), BATCH, std::chrono::seconds(0));
+        for (size_t j = 0; j < taken; ++j) {
+            sink += checksum(out[j]);
+        }
+    }
+    return per_item(start);
+}
+
+template <typename T>
+void compare(const char* type_name) {
+    uint64_t sink = 0;
+    const double generic = one_by_one_generic<T>(sink);
+    const double ring = one_by_one_ring<T>(sink);
+    const double bulk = bulk_ring<T>(sink);
+    std::cerr << type_name << ": generic " << generic << " ns/item, ring " << ring
+              << " ns/item, ring bulk " << bulk << " ns/item [" << sink << "]\n";
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    compare<int>("int");
+    compare<Payload>("64-byte struct");
+    return 0;
+}
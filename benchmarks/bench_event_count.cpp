@@ -0,0 +1,150 @@
+/**
+ * @file        bench_event_count.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Hand-off latency and uncontended notify cost of EventCount.
+ *
+ * @details
+ * Ping-pong between two threads: each one hands a token to the other and
+ * blocks until it comes back. The round trip is measured with a mutex and
+ * condition variable (what Cola used before) and with EventCount.
+ * A second measurement gives the cost of a notification nobody waits for,
+ * which is what every push into a busy queue pays.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+/* Project libraries */
+
+#include "event_count.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr size_t ROUND_TRIPS = 100000;
+constexpr size_t NOTIFIES = 10000000;
+
+/**
+ * @brief Token passed between the threads with a mutex and condition variable.
+ */
+class CvChannel {
+   public:
+    void send(size_t value) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            token = value;
+        }
+        cv.notify_one();
+    }
+
+    void wait_for(size_t value) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this, value] { return token == value; });
+    }
+
+    void notify_idle() { cv.notify_one(); }
+
+   private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_t token = 0;
+};
+
+/**
+ * @brief Token passed between the threads with an atomic and an EventCount.
+ */
+class EventCountChannel {
+   public:
+    void send(size_t value) {
+        token.store(value);
+        ec.notify();
+    }
+
+    void wait_for(size_t value) {
+        const auto forever = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        while (token.load() != value) {
+            const EventCount::Key key = ec.prepare_wait();
+            if (token.load() == value) {
+                ec.cancel_wait();
+                break;
+            }
+            ec.commit_wait(key, forever);
+        }
+    }
+
+    void notify_idle() { ec.notify(); }
+
+   private:
+    EventCount ec;
+    std::atomic<size_t> token{0};
+};
+
+/**
+ * @brief Average round trip between two threads.
+ * @return Nanoseconds per round trip.
+ */
+template <typename Channel>
+double round_trip() {
+    Channel ping;
+    Channel pong;
+    std::thread echo([&] {
+        for (size_t i = 1; i <= ROUND_TRIPS; ++i) {
+            ping.wait_for(i);
+            pong.send(i);
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 1; i <= ROUND_TRIPS; ++i) {
+        ping.send(i);
+        pong.wait_for(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    echo.join();
+    return std::chrono::duration<double, std::nano>(end - start).count() / ROUND_TRIPS;
+}
+
+/**
+ * @brief Cost of a notification with no waiter.
+ * @return Nanoseconds per notify.
+ */
+template <typename Channel>
+double idle_notify() {
+    Channel channel;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < NOTIFIES; ++i) {
+        channel.notify_idle();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / NOTIFIES;
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    const double cv_trip = round_trip<CvChannel>();
+    const double ec_trip = round_trip<EventCountChannel>();
+    std::cerr << "round trip: condition_variable " << cv_trip << " ns, EventCount " << ec_trip
+              << " ns (x" << cv_trip / ec_trip << ")\n";
+
+    const double cv_idle = idle_notify<CvChannel>();
+    const double ec_idle = idle_notify<EventCountChannel>();
+    std::cerr << "notify without waiter: condition_variable " << cv_idle << " ns, EventCount "
+              << ec_idle << " ns\n";
+    return 0;
+}
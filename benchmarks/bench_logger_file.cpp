@@ -0,0 +1,155 @@
+/**
+ * @file        bench_logger_file.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Sustained Logger throughput: FileSink versus std::cout + std::endl.
+ *
+ * @details
+ * Both paths write the same records to a file on the same filesystem:
+ *  - "cout+endl": std::cout is redirected to an std::ofstream, so every
+ *    record pays the formatting and the flush implied by std::endl.
+ *  - "FileSink": the console sink is replaced by a FileSink, which writes
+ *    whole buffers from its background thread.
+ *
+ *  - "MmapFileSink" (POSIX only): records are copied straight into a
+ *    memory-mapped region reserved with an atomic fetch-add.
+ *
+ * The sink measurements include the final flush(), so the reported
+ * rate is what actually reached the file (or the page cache for mmap).
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "console_sink.h"
+#include "file_sink.h"
+#include "logger.h"
+#include "mmap_file_sink.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr size_t RECORDS_PER_THREAD = 200000;
+constexpr size_t THREADS = 4;
+const char* const COUT_PATH = "bench_logger_cout.log";
+const char* const SINK_PATH = "bench_logger_sink.log";
+const char* const MMAP_PATH = "bench_logger_mmap.log";
+
+/**
+ * @brief Log RECORDS_PER_THREAD records from THREADS threads.
+ * @return Elapsed seconds.
+ */
+double run_load() {
+    const std::string payload(80, 'x');
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&payload] {
+            for (size_t i = 0; i < RECORDS_PER_THREAD; ++i) {
+                Logger::info(payload);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+double file_mb(const char* path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    return static_cast<double>(in.tellg()) / (1024.0 * 1024.0);
+}
+
+void report(const char* name, double seconds, double mb) {
+    std::cerr << name << ": " << mb << " MB in " << seconds << " s -> " << mb / seconds
+              << " MB/s\n";
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    std::remove(COUT_PATH);
+    std::remove(SINK_PATH);
+    Logger::set_min_level(Logger::Level::INFO);
+
+    // Current path: std::cout + std::endl, redirected to a file
+    double cout_seconds = 0.0;
+    {
+        std::ofstream out(COUT_PATH, std::ios::binary);
+        std::streambuf* original = std::cout.rdbuf(out.rdbuf());
+        cout_seconds = run_load();
+        std::cout.rdbuf(original);
+    }
+    report("cout+endl", cout_seconds, file_mb(COUT_PATH));
+
+    // FileSink path
+    double sink_seconds = 0.0;
+    {
+        FileSink::Options options;
+        options.path = SINK_PATH;
+        auto sink = std::make_shared<FileSink>(options);
+        Logger::clear_sinks();
+        Logger::add_sink(sink);
+
+        const auto start = std::chrono::steady_clock::now();
+        run_load();
+        sink->flush();
+        const auto end = std::chrono::steady_clock::now();
+        sink_seconds = std::chrono::duration<double>(end - start).count();
+
+        Logger::clear_sinks();
+        Logger::add_sink(std::make_shared<ConsoleSink>());
+    }
+    report("FileSink", sink_seconds, file_mb(SINK_PATH));
+
+#if !defined(_WIN32)
+    // MmapFileSink path
+    std::remove(MMAP_PATH);
+    double mmap_seconds = 0.0;
+    {
+        MmapFileSink::Options options;
+        options.path = MMAP_PATH;
+        options.region_size = 64u << 20;
+        options.when_full = MmapFileSink::FullPolicy::EXTEND;
+        auto sink = std::make_shared<MmapFileSink>(options);
+        Logger::clear_sinks();
+        Logger::add_sink(sink);
+
+        const auto start = std::chrono::steady_clock::now();
+        run_load();
+        sink->flush();
+        const auto end = std::chrono::steady_clock::now();
+        mmap_seconds = std::chrono::duration<double>(end - start).count();
+
+        Logger::clear_sinks();
+        Logger::add_sink(std::make_shared<ConsoleSink>());
+    }
+    report("MmapFileSink", mmap_seconds, file_mb(MMAP_PATH));
+    std::remove(MMAP_PATH);
+#endif
+
+    std::remove(COUT_PATH);
+    std::remove(SINK_PATH);
+    return 0;
+}
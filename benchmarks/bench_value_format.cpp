@@ -0,0 +1,86 @@
+/**
+ * @file        bench_value_format.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Per-item cost of building the "Data processed" message.
+ *
+ * @details
+ * Compares, for int and double values, the message PrintWorkerAction used
+ * to build (std::string concatenation with std::to_string) with the
+ * FormatBuffer path. Only the message construction is measured; the
+ * result is consumed so the compiler cannot drop it.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+/* Project libraries */
+
+#include "value_format.h"
+
+/*****************************************************************************/
+
+namespace {
+
+constexpr size_t ITERATIONS = 5000000;
+const std::string WORKER_NAME = "Worker1";
+
+/**
+ * @brief Run `build(i)` ITERATIONS times.
+ * @return Nanoseconds per item.
+ */
+template <typename Build>
+double measure(Build build, size_t& sink) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        sink += build(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS;
+}
+
+template <typename T>
+void compare(const char* type_name, T (*make)(size_t)) {
+    size_t sink = 0;
+
+    const double legacy = measure(
+        [make](size_t i) {
+            const std::string msg =
+                "[" + WORKER_NAME + "] Data processed: " + std::to_string(make(i));
+            return msg.size();
+        },
+        sink);
+
+    const double buffer = measure(
+        [make](size_t i) {
+            FormatBuffer<256> msg;
+            msg.append("[").append(WORKER_NAME).append("] Data processed: ").append(make(i));
+            return msg.size();
+        },
+        sink);
+
+    std::cerr << type_name << ": to_string " << legacy << " ns/item, FormatBuffer " << buffer
+              << " ns/item (x" << legacy / buffer << ") [" << sink << "]\n";
+}
+
+int make_int(size_t i) { return static_cast<int>(i * 7919u); }
+
+double make_double(size_t i) { return static_cast<double>(i) * 0.37; }
+
+}  // namespace
+
+/*****************************************************************************/
+
+int main() {
+    compare<int>("int", &make_int);
+    compare<double>("double", &make_double);
+    return 0;
+}
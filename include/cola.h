@@ -1,4 +1,4 @@
-/**
+﻿/**
  * @file        cola.h
  * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
  * @date        <2025-09-15>
@@ -7,11 +7,50 @@
  * @brief       Thread-safe bounded queue template.
  *
  * @details
- * `Cola<T>` is a generic, thread-safe queue with a fixed maximum size.
+ * `Cola<T>` is a generic, thread-safe queue with a bounded maximum size.
  * - Implements the producer-consumer pattern with synchronization
- *   using a mutex and condition variable.
+ *   using a mutex and an EventCount (futex-based on Linux), so pushes
+ *   skip the wake-up system call while no consumer is waiting.
  * - When the queue reaches its maximum size, the oldest element is discarded.
+ * - Optionally bounds the total size in bytes as well (`set_byte_budget`),
+ *   measured per element by a size function, `ColaItemBytes<T>` by
+ *   default: a push evicts the oldest elements until the new one fits,
+ *   `try_push` refuses it instead, and an element larger than the whole
+ *   budget is rejected.
+ * - Optional high/low watermarks (`set_watermarks`) for producer flow
+ *   control: the state turns high when the level (elements, or bytes with
+ *   a byte budget) reaches the high mark and only turns low again when it
+ *   falls to the low mark. It can be polled wait-free
+ *   (`is_above_high_watermark`) or delivered to a callback outside the
+ *   queue lock, so ingest can pause before data is evicted.
+ * - The maximum size can be changed at run time (`set_capacity`) or left
+ *   to an elastic policy (`set_elastic_capacity`): it doubles, up to an
+ *   upper bound, instead of evicting on a full push, and halves, down to a
+ *   lower bound, after a window of pops in which occupancy never exceeded
+ *   a quarter of it. Resizing never copies more than the queued elements
+ *   once, and ring storage is given back to the allocator on shrink.
  * - Provides timeout-based retrieval (`pop`) using `nonstd::optional`.
+ * - Optionally bounds latency with CoDel (`set_codel`): each element is
+ *   stamped when pushed and, when the time elements spend queued stays
+ *   above a target for a whole interval, `pop` drops elements from the
+ *   head at an increasing rate until the standing queue is gone. Short
+ *   bursts, which drain within the interval, are not affected.
+ * - Optionally discards stale elements: each element may carry a deadline,
+ *   given at push time or derived from a queue-level TTL (`set_ttl`).
+ *   Expired elements are never returned by `pop`; they are skipped when
+ *   they reach the head, or purged when a push finds the queue full, and
+ *   are counted and handed to an optional expiry callback instead.
+ * - Optional adaptive LIFO (`set_adaptive_lifo`): while the queue is
+ *   shallow elements are served FIFO; once its depth or the head sojourn
+ *   time passes a threshold, the newest element is served first, so recent
+ *   work still meets its latency target during overload. FIFO resumes
+ *   when the backlog is drained.
+ * - Counts pushed, popped and discarded elements and the time spent in each
+ *   order (`get_stats`).
+ * - Can signal a shared `EventCount` on every push (`attach_notifier`),
+ *   so one consumer can wait on several queues at once (see ColaSelector).
+ * - On Linux, can signal an eventfd when it goes from empty to non-empty
+ *   (`attach_event_fd`), so it can be drained from an epoll loop.
  *
  * The class is safe for concurrent use by multiple producer and consumer threads.
  */
@@ -25,15 +64,62 @@
 
 /* Standard libraries */
 
+#include <atomic>
 #include <chrono>
-#include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 /* Third party libraries */
 
 #include "third_party/optional.hpp"
 
+/* Project libraries */
+
+#include "cola_event_fd.h"
+#include "cola_storage.h"
+#include "event_count.h"
+
+/*****************************************************************************/
+
+/**
+ * @struct ColaItemBytes
+ * @brief Default size of an element for Cola byte budgets: sizeof(T).
+ *        Specialize it for types owning heap memory, or pass a size
+ *        function to Cola::set_byte_budget().
+ * @tparam T Element type.
+ */
+template <typename T>
+struct ColaItemBytes {
+    static size_t of(const T&) { return sizeof(T); }
+};
+
+/*****************************************************************************/
+
+/**
+ * @struct ColaStats
+ * @brief Snapshot of the counters of a Cola.
+ */
+struct ColaStats {
+    size_t size = 0;                       /**< Elements currently queued. */
+    size_t bytes = 0;                      /**< Bytes currently queued (with a byte budget). */
+    uint64_t pushed = 0;                   /**< Elements accepted by push(). */
+    uint64_t popped = 0;                   /**< Elements returned by pop(). */
+    uint64_t evicted = 0;                  /**< Oldest elements dropped for lack of room. */
+    uint64_t rejected = 0;                 /**< New elements refused for lack of room. */
+    uint64_t codel_dropped = 0;            /**< Elements dropped by CoDel (sojourn time). */
+    uint64_t expired = 0;                  /**< Elements discarded past their deadline. */
+    uint64_t lifo_switches = 0;            /**< Times adaptive LIFO switched to LIFO. */
+    size_t capacity = 0;                   /**< Current maximum size. */
+    uint64_t capacity_grows = 0;           /**< Times the elastic policy grew the capacity. */
+    uint64_t capacity_shrinks = 0;         /**< Times the elastic policy shrank the capacity. */
+    std::chrono::nanoseconds fifo_time{0}; /**< Time served FIFO with adaptive LIFO enabled. */
+    std::chrono::nanoseconds lifo_time{0}; /**< Time served LIFO. */
+};
+
 /*****************************************************************************/
 
 /**
@@ -41,7 +127,7 @@
  * @brief Thread-safe bounded queue.
  * @tparam T Type of elements stored in the queue.
  *
- * This class implements a fixed-size, thread-safe FIFO queue
+ * This class implements a bounded, thread-safe FIFO queue
  * with a maximum capacity (default: 5). When the queue is full,
  * the oldest element is discarded.
  */
@@ -49,6 +135,32 @@ template <typename T>
 class Cola {
     /******************************************************************/
 
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief Clock used to measure the time elements spend in the queue.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Receives the elements discarded because their deadline passed.
+     */
+    using ExpiryCallback = std::function<void(T&&)>;
+
+    /**
+     * @brief Returns the size in bytes charged to an element by a byte budget.
+     */
+    using SizeFunction = std::function<size_t(const T&)>;
+
+    /**
+     * @brief Receives the watermark state: true once the high mark is
+     *        reached, false once the level is back down to the low mark.
+     */
+    using WatermarkCallback = std::function<void(bool above_high)>;
+
+    /******************************************************************/
+
     /* Public Methods */
 
    public:
@@ -66,7 +178,7 @@ class Cola {
     /**
      * @brief Disable copy constructor.
      *        Cola cannot be copied because it manages synchronization primitives
-     *        (std::mutex, std::condition_variable), which are non-copyable.
+     *        (std::mutex, EventCount), which are non-copyable.
      */
     Cola(const Cola&) = delete;
 
@@ -79,7 +191,7 @@ class Cola {
 
     /**
      * @brief Disable move constructor.
-     *        Although std::mutex and std::condition_variable technically
+     *        Although std::mutex and EventCount technically
      *        have move operations deleted, even if they were movable,
      *        transferring them between Cola instances would break
      *        synchronization guarantees. To enforce strict ownership,
@@ -102,8 +214,29 @@ class Cola {
      */
     void push(T dato);
 
+    /**
+     * @brief Push a new element that must be processed before a deadline.
+     *        If the buffer is full, expired elements are discarded first,
+     *        then the oldest one.
+     * @param dato Data to insert in the buffer.
+     * @param deadline Time after which the element is discarded instead of popped.
+     */
+    void push(T dato, Clock::time_point deadline);
+
+    /**
+     * @brief Push a new element only if it fits without evicting anything
+     *        (in number of elements and, with a byte budget, in bytes).
+     *        Expired elements are still purged to make room.
+     * @param dato Data to insert; left untouched when refused, so the
+     *        caller can retry or divert it.
+     * @return false if the queue is full.
+     */
+    bool try_push(T&& dato);
+
     /**
      * @brief Removes the oldest element from the buffer, waiting up to a timeout.
+     *        In LIFO mode (see set_adaptive_lifo) the newest one is removed.
+     *        Expired elements found on the way are discarded.
      * @param timeout Maximum time to wait for data.
      * @return An `optional<T>` containing the retrieved value if available.
      *         Returns `nonstd::nullopt` if the timeout expires without data.
@@ -115,28 +248,477 @@ class Cola {
      */
     nonstd::optional<T> pop(std::chrono::seconds timeout);
 
+    /**
+     * @brief Push several elements at once, as if by repeated push() calls.
+     *        For trivially copyable T, without CoDel, deadlines, adaptive
+     *        LIFO or a byte budget, they are copied with at most two memcpy
+     *        calls.
+     * @param items Elements to copy in.
+     * @param count Number of elements.
+     */
+    void push_bulk(const T* items, size_t count);
+
+    /**
+     * @brief Push several elements at once, moving them in.
+     *        Same rules as the copying overload.
+     * @param items Elements to move in; left empty.
+     */
+    void push_bulk(std::vector<T>&& items);
+
+    /**
+     * @brief Removes up to max_count elements, waiting up to a timeout for the first one.
+     *        Follows the same rules as pop(); the fast path mirrors push_bulk().
+     * @param out Receives the elements (assigned, so it must hold valid objects).
+     * @param max_count Capacity of out.
+     * @param timeout Maximum time to wait for data.
+     * @return Number of elements written, 0 if the timeout expires without data.
+     */
+    size_t pop_bulk(T* out, size_t max_count, std::chrono::seconds timeout);
+
+    /**
+     * @brief Like pop(), but writes into an out-parameter instead of an optional.
+     * @param out Receives the element.
+     * @param timeout Maximum time to wait for data.
+     * @return false if the timeout expires without data (out is untouched).
+     */
+    bool pop_into(T& out, std::chrono::seconds timeout);
+
+    /**
+     * @brief Removes the next element and passes it to fn, waiting up to a timeout.
+     *        Follows the same rules as pop(); the element is moved out of the
+     *        queue once and fn runs without the lock held.
+     * @param fn Callable taking `T&`.
+     * @param timeout Maximum time to wait for data.
+     * @return false if the timeout expires without data (fn is not called).
+     */
+    template <typename Fn>
+    bool consume(Fn&& fn, std::chrono::seconds timeout);
+
+    /**
+     * @brief Removes the next element without waiting.
+     *        Follows the same rules as pop() (ordering, expiry, CoDel).
+     * @return The element, or `nonstd::nullopt` if none is available.
+     */
+    nonstd::optional<T> try_pop();
+
     /**
      * @brief Getter of the buffer size.
+     *        Wait-free: reads a counter published by push and pop instead of
+     *        taking the lock, so it may be stale while they run concurrently.
      * @return Size of the buffer.
      */
     size_t get_size(void) const;
 
     /**
      * @brief Indicates if the buffer is empty or not.
+     *        Wait-free and approximate under concurrency, like get_size().
      * @return true The buffer is empty.
      * @return false The buffer is not empty.
      */
     bool is_empty(void) const;
 
+    /**
+     * @brief Enable CoDel active queue management.
+     *        Elements already queued are considered pushed now.
+     * @param target Acceptable standing sojourn time (typically 5% of interval).
+     * @param interval Time the sojourn must stay above target before dropping
+     *        starts; should cover the usual processing time of a burst.
+     */
+    void set_codel(Clock::duration target, Clock::duration interval);
+
+    /**
+     * @brief Disable CoDel. Elements are no longer timestamped.
+     */
+    void disable_codel();
+
+    /**
+     * @brief Give every element pushed without an explicit deadline a
+     *        deadline of push time + ttl.
+     * @param ttl Time to live; zero disables the default deadline.
+     */
+    void set_ttl(Clock::duration ttl);
+
+    /**
+     * @brief Set the function receiving expired elements.
+     *        It is called by the pushing or popping thread, outside the lock.
+     * @param callback Expiry callback, or an empty function to only count them.
+     */
+    void set_expiry_callback(ExpiryCallback callback);
+
+    /**
+     * @brief Enable adaptive LIFO ordering.
+     * @param depth Switch to LIFO when this many elements are queued (0: ignore depth).
+     * @param sojourn Switch to LIFO when the oldest element has waited this
+     *        long (zero: ignore sojourn).
+     */
+    void set_adaptive_lifo(size_t depth, Clock::duration sojourn = Clock::duration::zero());
+
+    /**
+     * @brief Go back to plain FIFO ordering.
+     */
+    void disable_adaptive_lifo();
+
+    /**
+     * @brief Change the maximum size.
+     *        When lowered below the current size, the oldest elements are
+     *        evicted. With elastic capacity enabled, the value is clamped to
+     *        its bounds.
+     * @param capacity New maximum number of elements.
+     */
+    void set_capacity(size_t capacity);
+
+    /**
+     * @brief Getter of the current maximum size.
+     */
+    size_t get_capacity(void) const;
+
+    /**
+     * @brief Let the maximum size follow the load within bounds.
+     *        A push that would evict doubles the capacity instead (up to
+     *        max_capacity); a window of as many pops as the capacity, in
+     *        which occupancy stayed at or below a quarter of it, halves it
+     *        (down to min_capacity).
+     * @param min_capacity Lower bound of the capacity.
+     * @param max_capacity Upper bound of the capacity.
+     */
+    void set_elastic_capacity(size_t min_capacity, size_t max_capacity);
+
+    /**
+     * @brief Stop adjusting the capacity; it keeps its current value.
+     */
+    void disable_elastic_capacity();
+
+    /**
+     * @brief Bound the total size of the queued elements in bytes, on top
+     *        of the element count. Queued elements are measured now, and
+     *        the oldest are evicted if they exceed the budget.
+     * @param max_bytes Maximum total size.
+     * @param size_of Size of one element, called once per push under the lock.
+     */
+    void set_byte_budget(size_t max_bytes, SizeFunction size_of = ColaItemBytes<T>::of);
+
+    /**
+     * @brief Remove the byte budget; only the element count is bounded.
+     */
+    void disable_byte_budget();
+
+    /**
+     * @brief Enable high/low watermarks with hysteresis.
+     *        The level is the number of elements, or the queued bytes when
+     *        a byte budget is set.
+     * @param high Level at which the state turns high.
+     * @param low Level at which the state turns low again (at most high).
+     * @param callback Called on each state change, without any lock held, so
+     *        it may push, pop or reconfigure the queue. Calls are never
+     *        concurrent nor nested: a change made while one is running
+     *        (e.g. by the callback itself) is delivered by the same thread
+     *        once it returns. May be empty to only poll the state.
+     */
+    void set_watermarks(size_t high, size_t low, WatermarkCallback callback = WatermarkCallback());
+
+    /**
+     * @brief Disable the watermarks; the state turns low (reported if it was high).
+     */
+    void disable_watermarks();
+
+    /**
+     * @brief Whether the high watermark was reached and the level has not
+     *        yet fallen to the low one. Wait-free.
+     */
+    bool is_above_high_watermark(void) const;
+
+    /**
+     * @brief Signal a notifier after every push, in addition to the queue's
+     *        own event count. The notifier may be shared by several queues,
+     *        but a queue has only one: this replaces any previous notifier.
+     * @param notifier Notifier to signal, or nullptr to stop signalling.
+     */
+    void attach_notifier(std::shared_ptr<EventCount> notifier);
+
+#if defined(__linux__)
+    /**
+     * @brief Signal an eventfd whenever the queue goes from empty to non-empty.
+     *        Signalled at once if the queue already holds data.
+     * @param event_fd Event fd to signal, or nullptr to stop signalling.
+     */
+    void attach_event_fd(std::shared_ptr<ColaEventFd> event_fd);
+#endif
+
+    /**
+     * @brief Getter of the queue counters.
+     * @return A consistent snapshot of the statistics.
+     */
+    ColaStats get_stats(void) const;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+   private:
+    /**
+     * @struct CodelState
+     * @brief Control state of CoDel (RFC 8289).
+     */
+    struct CodelState {
+        bool enabled = false;                 /**< CoDel active. */
+        Clock::duration target{};             /**< Acceptable standing sojourn time. */
+        Clock::duration interval{};           /**< Sliding window of the minimum sojourn. */
+        Clock::time_point first_above_time{}; /**< When the sojourn may start dropping. */
+        Clock::time_point drop_next{};        /**< Next drop while dropping. */
+        uint32_t count = 0;                   /**< Drops in the current dropping state. */
+        uint32_t last_count = 0;              /**< count when the last dropping state began. */
+        bool dropping = false;                /**< In dropping state. */
+    };
+
+    /**
+     * @struct LifoState
+     * @brief Configuration and current mode of adaptive LIFO.
+     */
+    struct LifoState {
+        bool enabled = false;        /**< Adaptive LIFO active. */
+        size_t depth = 0;            /**< Depth threshold, 0 if unused. */
+        Clock::duration sojourn{};   /**< Sojourn threshold, zero if unused. */
+        bool lifo = false;           /**< Currently serving LIFO. */
+        Clock::time_point since{};   /**< Start of the current mode. */
+        Clock::duration fifo_time{}; /**< Accumulated FIFO time. */
+        Clock::duration lifo_time{}; /**< Accumulated LIFO time. */
+    };
+
+    /**
+     * @struct ElasticState
+     * @brief Bounds and occupancy window of the elastic capacity policy.
+     */
+    struct ElasticState {
+        bool enabled = false; /**< Elastic capacity active. */
+        size_t lower = 0;     /**< Minimum capacity. */
+        size_t upper = 0;     /**< Maximum capacity. */
+        size_t peak = 0;      /**< Highest size seen in the current window. */
+        size_t popped = 0;    /**< Pops in the current window. */
+    };
+
+    /**
+     * @struct ByteBudget
+     * @brief Configuration of the byte budget.
+     */
+    struct ByteBudget {
+        bool enabled = false; /**< Byte budget active. */
+        size_t max_bytes = 0; /**< Maximum total size. */
+        SizeFunction size_of; /**< Size of one element. */
+    };
+
+    /**
+     * @struct Watermarks
+     * @brief Configuration of the high/low watermarks.
+     */
+    struct Watermarks {
+        bool enabled = false; /**< Watermarks active. */
+        size_t high = 0;      /**< Level turning the state high. */
+        size_t low = 0;       /**< Level turning the state low. */
+    };
+
+    /**
+     * @struct ItemMeta
+     * @brief Timing and size information of a queued element.
+     */
+    struct ItemMeta {
+        Clock::time_point enqueued; /**< Push time. */
+        Clock::time_point deadline; /**< Expiry time, Clock::time_point::max() if none. */
+        size_t bytes;               /**< Size charged to the byte budget, 0 without one. */
+    };
+
+    /**
+     * @struct Wakers
+     * @brief External parties to signal after a push, copied under the lock.
+     */
+    struct Wakers {
+        std::shared_ptr<EventCount> notifier; /**< Shared notifier, if any. */
+#if defined(__linux__)
+        std::shared_ptr<ColaEventFd> event_fd; /**< Event fd, if the queue was empty. */
+#endif
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Whether per-element metadata is maintained (mtx held).
+     */
+    bool tracks_meta() const;
+
+    /**
+     * @brief Start maintaining metadata, stamping the queued elements with
+     *        the current time and no deadline (mtx held).
+     */
+    void start_tracking_meta();
+
+    /**
+     * @brief Common part of every push variant: insert and wake consumers.
+     * @param deadline Deadline, Clock::time_point::max() if none.
+     * @param evict Evict the oldest elements to make room, instead of refusing dato.
+     * @return false if dato was refused (and left untouched).
+     */
+    bool push_and_wake(T&& dato, Clock::time_point deadline, bool evict);
+
+    /**
+     * @brief Insertion part of push_and_wake() (mtx held).
+     * @param evict Evict the oldest elements to make room, instead of refusing dato.
+     * @param expired Receives the elements purged to make room.
+     * @return false if dato was refused (and left untouched).
+     */
+    bool push_locked(T&& dato, Clock::time_point deadline, bool evict, std::vector<T>& expired);
+
+    /**
+     * @brief Whether one more element of the given size fits (mtx held).
+     */
+    bool fits(size_t bytes) const;
+
+    /**
+     * @brief Publish buffer.size() to approx_size and update the watermark
+     *        state (mtx held).
+     */
+    void publish_size();
+
+    /**
+     * @brief Deliver a pending watermark state change to the callback (mtx not held).
+     */
+    void report_watermark();
+
+    /**
+     * @brief Common part of both push_bulk() overloads.
+     * @tparam Source `const T*` to copy the elements, or a std::move_iterator to move them.
+     */
+    template <typename Source>
+    void push_bulk_from(Source items, size_t count);
+
+    /**
+     * @brief Copy the parties to signal after a push (mtx held).
+     * @param was_empty Whether the queue was empty before the push.
+     */
+    Wakers collect_wakers(bool was_empty) const;
+
+    /**
+     * @brief Wake consumers after a push (mtx not held).
+     * @param all Wake every waiting consumer instead of one.
+     */
+    void wake(const Wakers& wakers, bool all);
+
+    /**
+     * @brief Call take() until it succeeds, sleeping on not_empty in between.
+     * @param take Attempts to take data (locking on its own), true on success.
+     * @param until Deadline of the wait.
+     * @return false if the deadline passed.
+     */
+    template <typename Take>
+    bool wait_until_taken(Take take, Clock::time_point until);
+
+    /**
+     * @brief Lock and take up to max_count elements (mtx not held).
+     * @param expired Receives the expired elements skipped on the way.
+     */
+    size_t try_take_bulk(T* out, size_t max_count, std::vector<T>& expired);
+
+    /**
+     * @brief Lock and take the next element if there is one (mtx not held).
+     * @param out Receives the element.
+     * @param expired Receives the expired elements skipped on the way.
+     */
+    bool try_take(nonstd::optional<T>& out, std::vector<T>& expired);
+
+    /**
+     * @brief Common part of every pop variant (mtx held).
+     * @param expired Receives the expired elements skipped on the way.
+     * @param sink Called with the element (as an rvalue) before it is removed.
+     * @return false if only expired elements were queued.
+     */
+    template <typename Sink>
+    bool take_locked(std::vector<T>& expired, Sink sink);
+
+    /**
+     * @brief Move every expired element out of the queue (mtx held).
+     * @param now Current time.
+     * @param expired Receives the removed elements.
+     */
+    void purge_expired(Clock::time_point now, std::vector<T>& expired);
+
+    /**
+     * @brief Move the expired elements at the served end out of the queue (mtx held).
+     * @param now Current time.
+     * @param from_back Check the newest elements instead of the oldest.
+     * @param expired Receives the removed elements.
+     */
+    void skip_expired(Clock::time_point now, bool from_back, std::vector<T>& expired);
+
+    /**
+     * @brief Hand expired elements to the callback (mtx not held).
+     * @param expired Elements removed by purge_expired() or skip_expired().
+     */
+    void report_expired(std::vector<T>& expired);
+
+    /**
+     * @brief Whether the sojourn of the head element allows a drop (mtx held).
+     * @param now Current time.
+     */
+    bool codel_ok_to_drop(Clock::time_point now);
+
+    /**
+     * @brief Run the CoDel state machine, dropping head elements as needed.
+     *        Never drops the last element (mtx held, buffer not empty).
+     * @param now Current time.
+     */
+    void codel_dequeue(Clock::time_point now);
+
+    /**
+     * @brief Time of the next drop: t + interval / sqrt(count).
+     */
+    Clock::time_point codel_control_law(Clock::time_point t) const;
+
+    /**
+     * @brief Re-evaluate the adaptive LIFO mode (mtx held).
+     *        LIFO starts when a threshold is reached and ends when the queue is empty.
+     * @param now Current time.
+     */
+    void update_lifo(Clock::time_point now);
+
+    /**
+     * @brief Grow the capacity, by doubling, towards needed elements
+     *        within the elastic bounds (mtx held).
+     * @param needed Number of elements that should fit.
+     */
+    void elastic_grow(size_t needed);
+
+    /**
+     * @brief Account for popped elements and halve the capacity at the end
+     *        of a window of low occupancy (mtx held).
+     * @param count Number of elements just popped.
+     */
+    void elastic_on_pop(size_t count);
+
+    /**
+     * @brief Set max_size, evict the oldest elements beyond it and release
+     *        unused storage (mtx held).
+     */
+    void apply_capacity(size_t capacity);
+
+    /**
+     * @brief Remove the head element and its metadata (mtx held).
+     */
+    void discard_front();
+
+    /**
+     * @brief Remove the newest element and its metadata (mtx held).
+     */
+    void discard_back();
+
     /******************************************************************/
 
     /* Private Attributes */
 
    private:
     /**
-     * @brief FIFO buffer.
+     * @brief FIFO buffer (a ring buffer for trivially copyable T).
      */
-    std::deque<T> buffer;
+    ColaStorage<T> buffer;
 
     /**
      * @brief Mutex.
@@ -144,15 +726,116 @@ class Cola {
     mutable std::mutex mtx;
 
     /**
-     * @brief Condition variable.
+     * @brief buffer.size(), stored after every push and pop for lock-free readers.
      */
-    std::condition_variable cv;
+    std::atomic<size_t> approx_size;
+
+    /**
+     * @brief Signalled after each push; consumers of pop() wait on it.
+     */
+    EventCount not_empty;
 
     /**
      * @brief Maximum size of the buffer.
      */
     size_t max_size;
 
+    /**
+     * @brief Metadata of each element of buffer, same order.
+     *        Only maintained while CoDel, deadlines, adaptive LIFO or a
+     *        byte budget are in use (see tracks_meta()).
+     */
+    std::deque<ItemMeta> meta;
+
+    /**
+     * @brief Set once deadlines are used (TTL or explicit); never cleared,
+     *        since queued elements may still carry one.
+     */
+    bool deadlines;
+
+    /**
+     * @brief Default time to live, zero if none.
+     */
+    Clock::duration ttl;
+
+    /**
+     * @brief Receives expired elements.
+     */
+    ExpiryCallback on_expired;
+
+    /**
+     * @brief CoDel configuration and state.
+     */
+    CodelState codel;
+
+    /**
+     * @brief Adaptive LIFO configuration and state.
+     */
+    LifoState lifo;
+
+    /**
+     * @brief Elastic capacity configuration and state.
+     */
+    ElasticState elastic;
+
+    /**
+     * @brief Byte budget configuration.
+     */
+    ByteBudget budget;
+
+    /**
+     * @brief Total bytes charged by the queued elements (with a byte budget).
+     */
+    size_t queued_bytes;
+
+    /**
+     * @brief Watermark configuration.
+     */
+    Watermarks watermarks;
+
+    /**
+     * @brief Watermark state, written under mtx and readable without it.
+     */
+    std::atomic<bool> above_high;
+
+    /**
+     * @brief Last watermark state handed to the callback.
+     */
+    std::atomic<bool> reported_high;
+
+    /**
+     * @brief Guards on_watermark and delivering_watermark; never held
+     *        together with mtx, nor while the callback runs.
+     */
+    std::mutex watermark_mtx;
+
+    /**
+     * @brief Receives watermark state changes (guarded by watermark_mtx).
+     */
+    WatermarkCallback on_watermark;
+
+    /**
+     * @brief Whether a thread is delivering watermark changes (guarded by watermark_mtx).
+     */
+    bool delivering_watermark;
+
+    /**
+     * @brief Notifier signalled after each push, if any.
+     */
+    std::shared_ptr<EventCount> notifier;
+
+#if defined(__linux__)
+    /**
+     * @brief Event fd signalled on the empty to non-empty transition, if any.
+     */
+    std::shared_ptr<ColaEventFd> event_fd;
+#endif
+
+    /**
+     * @brief Counters (size is filled in by get_stats()).
+     */
+    ColaStats stats;
+
     /******************************************************************/
 };
 
@@ -16,6 +16,13 @@
 
 /*****************************************************************************/
 
+/* Standard libraries */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+
 /* Project libraries */
 
 #include "cola.h"
@@ -28,7 +35,15 @@
  * @details Constructor of Cola, setting the maximum buffer size.
  */
 template <typename T>
-Cola<T>::Cola(size_t max_size) : max_size(max_size) {}
+Cola<T>::Cola(size_t max_size)
+    : approx_size(0),
+      max_size(max_size),
+      deadlines(false),
+      ttl(Clock::duration::zero()),
+      queued_bytes(0),
+      above_high(false),
+      reported_high(false),
+      delivering_watermark(false) {}
 
 /**
  * @details Inserts a new element into the buffer.
@@ -36,12 +51,17 @@ Cola<T>::Cola(size_t max_size) : max_size(max_size) {}
  */
 template <typename T>
 void Cola<T>::push(T dato) {
-    std::unique_lock<std::mutex> lock(mtx);
-    if (buffer.size() >= max_size) {
-        buffer.pop_front();  // Take out the eldest "dato"
-    }
-    buffer.push_back(std::move(dato));
-    cv.notify_one();  // notify the waiting worker
+    push_and_wake(std::move(dato), Clock::time_point::max(), true);
+}
+
+template <typename T>
+void Cola<T>::push(T dato, Clock::time_point deadline) {
+    push_and_wake(std::move(dato), deadline, true);
+}
+
+template <typename T>
+bool Cola<T>::try_push(T&& dato) {
+    return push_and_wake(std::move(dato), Clock::time_point::max(), false);
 }
 
 /**
@@ -52,25 +72,87 @@ void Cola<T>::push(T dato) {
  */
 template <typename T>
 nonstd::optional<T> Cola<T>::pop(std::chrono::seconds timeout) {
-    std::unique_lock<std::mutex> lock(mtx);
+    std::vector<T> expired;
+    nonstd::optional<T> out;
+    wait_until_taken([&] { return try_take(out, expired); }, Clock::now() + timeout);
+    report_expired(expired);
+    report_watermark();
+    return out;
+}
 
-    // Wait until new data is added or until time is out
-    if (!cv.wait_for(lock, timeout, [this] { return !buffer.empty(); })) {
-        return nonstd::nullopt;
+template <typename T>
+nonstd::optional<T> Cola<T>::try_pop() {
+    std::vector<T> expired;
+    nonstd::optional<T> out;
+    try_take(out, expired);
+    report_expired(expired);
+    report_watermark();
+    return out;
+}
+
+/**
+ * @details The element cannot stay in the buffer while fn runs: the lock
+ *          is released, and a full push could evict it or another consumer
+ *          take it. It is moved once, straight out of the buffer, and
+ *          destroyed after fn returns.
+ */
+template <typename T>
+template <typename Fn>
+bool Cola<T>::consume(Fn&& fn, std::chrono::seconds timeout) {
+    std::vector<T> expired;
+    nonstd::optional<T> dato;
+    wait_until_taken([&] { return try_take(dato, expired); }, Clock::now() + timeout);
+    report_expired(expired);
+    report_watermark();
+    if (!dato) {
+        return false;
     }
+    fn(*dato);
+    return true;
+}
 
-    T out = std::move(buffer.front());
-    buffer.pop_front();
-    return out;
+template <typename T>
+void Cola<T>::push_bulk(const T* items, size_t count) {
+    push_bulk_from(items, count);
+}
+
+template <typename T>
+void Cola<T>::push_bulk(std::vector<T>&& items) {
+    push_bulk_from(std::make_move_iterator(items.data()), items.size());
+    items.clear();
+}
+
+template <typename T>
+size_t Cola<T>::pop_bulk(T* out, size_t max_count, std::chrono::seconds timeout) {
+    if (max_count == 0) {
+        return 0;
+    }
+    std::vector<T> expired;
+    size_t taken = 0;
+    wait_until_taken(
+        [&] {
+            taken = try_take_bulk(out, max_count, expired);
+            return taken > 0;
+        },
+        Clock::now() + timeout);
+    report_expired(expired);
+    report_watermark();
+    return taken;
+}
+
+template <typename T>
+bool Cola<T>::pop_into(T& out, std::chrono::seconds timeout) {
+    return pop_bulk(&out, 1, timeout) == 1;
 }
 
 /**
  * @details Returns the size of the buffer.
+ *          Relaxed ordering is enough: the value is only a hint and no
+ *          other data is read through it.
  */
 template <typename T>
 size_t Cola<T>::get_size(void) const {
-    std::lock_guard<std::mutex> lock(mtx);
-    return buffer.size();
+    return approx_size.load(std::memory_order_relaxed);
 }
 
 /**
@@ -79,12 +161,762 @@ size_t Cola<T>::get_size(void) const {
  */
 template <typename T>
 bool Cola<T>::is_empty(void) const {
+    return approx_size.load(std::memory_order_relaxed) == 0;
+}
+
+template <typename T>
+void Cola<T>::set_codel(Clock::duration target, Clock::duration interval) {
+    std::lock_guard<std::mutex> lock(mtx);
+    start_tracking_meta();
+    codel = CodelState();
+    codel.enabled = true;
+    codel.target = target;
+    codel.interval = interval;
+}
+
+template <typename T>
+void Cola<T>::disable_codel() {
+    std::lock_guard<std::mutex> lock(mtx);
+    codel = CodelState();
+    if (!tracks_meta()) {
+        meta.clear();
+    }
+}
+
+template <typename T>
+void Cola<T>::set_ttl(Clock::duration ttl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (ttl > Clock::duration::zero() && !deadlines) {
+        start_tracking_meta();
+        deadlines = true;
+    }
+    this->ttl = ttl;
+}
+
+template <typename T>
+void Cola<T>::set_expiry_callback(ExpiryCallback callback) {
+    std::lock_guard<std::mutex> lock(mtx);
+    on_expired = std::move(callback);
+}
+
+template <typename T>
+void Cola<T>::set_adaptive_lifo(size_t depth, Clock::duration sojourn) {
+    std::lock_guard<std::mutex> lock(mtx);
+    start_tracking_meta();
+    if (!lifo.enabled) {
+        lifo = LifoState();
+        lifo.enabled = true;
+        lifo.since = Clock::now();
+    }
+    lifo.depth = depth;
+    lifo.sojourn = sojourn;
+}
+
+template <typename T>
+void Cola<T>::disable_adaptive_lifo() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!lifo.enabled) {
+        return;
+    }
+    const Clock::duration elapsed = Clock::now() - lifo.since;
+    (lifo.lifo ? lifo.lifo_time : lifo.fifo_time) += elapsed;
+    lifo.enabled = false;
+    lifo.lifo = false;
+    if (!tracks_meta()) {
+        meta.clear();
+    }
+}
+
+template <typename T>
+void Cola<T>::set_capacity(size_t capacity) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (elastic.enabled) {
+            capacity = std::min(std::max(capacity, elastic.lower), elastic.upper);
+        }
+        apply_capacity(capacity);
+    }
+    report_watermark();
+}
+
+template <typename T>
+size_t Cola<T>::get_capacity(void) const {
     std::lock_guard<std::mutex> lock(mtx);
-    return buffer.empty();
+    return max_size;
+}
+
+template <typename T>
+void Cola<T>::set_elastic_capacity(size_t min_capacity, size_t max_capacity) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        elastic = ElasticState();
+        elastic.enabled = true;
+        elastic.lower = std::max<size_t>(min_capacity, 1);
+        elastic.upper = std::max(elastic.lower, max_capacity);
+        elastic.peak = buffer.size();
+        apply_capacity(std::min(std::max(max_size, elastic.lower), elastic.upper));
+    }
+    report_watermark();
+}
+
+template <typename T>
+void Cola<T>::disable_elastic_capacity() {
+    std::lock_guard<std::mutex> lock(mtx);
+    elastic.enabled = false;
+}
+
+/**
+ * @details The budget relies on the per-element metadata to remember what
+ *          each element was charged, so removals never call size_of.
+ */
+template <typename T>
+void Cola<T>::set_byte_budget(size_t max_bytes, SizeFunction size_of) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        start_tracking_meta();
+        budget.enabled = true;
+        budget.max_bytes = max_bytes;
+        budget.size_of = std::move(size_of);
+        queued_bytes = 0;
+        for (size_t i = 0; i < buffer.size(); ++i) {
+            meta[i].bytes = budget.size_of(buffer[i]);
+            queued_bytes += meta[i].bytes;
+        }
+        while (queued_bytes > budget.max_bytes) {
+            discard_front();
+            ++stats.evicted;
+        }
+        publish_size();
+    }
+    report_watermark();
+}
+
+template <typename T>
+void Cola<T>::disable_byte_budget() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        budget = ByteBudget();
+        queued_bytes = 0;
+        for (ItemMeta& item : meta) {
+            item.bytes = 0;
+        }
+        if (!tracks_meta()) {
+            meta.clear();
+        }
+        publish_size();
+    }
+    report_watermark();
+}
+
+/**
+ * @details The level is re-evaluated at once, so a queue already above
+ *          high is reported as such.
+ */
+template <typename T>
+void Cola<T>::set_watermarks(size_t high, size_t low, WatermarkCallback callback) {
+    {
+        std::lock_guard<std::mutex> lock(watermark_mtx);
+        on_watermark = std::move(callback);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        watermarks.enabled = true;
+        watermarks.high = high;
+        watermarks.low = std::min(low, high);
+        publish_size();
+    }
+    report_watermark();
+}
+
+template <typename T>
+void Cola<T>::disable_watermarks() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        watermarks.enabled = false;
+        above_high.store(false, std::memory_order_release);
+    }
+    report_watermark();
+}
+
+template <typename T>
+bool Cola<T>::is_above_high_watermark(void) const {
+    return above_high.load(std::memory_order_acquire);
+}
+
+template <typename T>
+void Cola<T>::attach_notifier(std::shared_ptr<EventCount> notifier) {
+    std::lock_guard<std::mutex> lock(mtx);
+    this->notifier = std::move(notifier);
+}
+
+#if defined(__linux__)
+template <typename T>
+void Cola<T>::attach_event_fd(std::shared_ptr<ColaEventFd> event_fd) {
+    bool pending = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        this->event_fd = event_fd;
+        pending = !buffer.empty();
+    }
+    if (event_fd && pending) {
+        event_fd->signal();  // The consumer would otherwise never hear of it
+    }
+}
+#endif
+
+/**
+ * @details The time spent in the current mode is added to the snapshot.
+ */
+template <typename T>
+ColaStats Cola<T>::get_stats(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    ColaStats snapshot = stats;
+    snapshot.size = buffer.size();
+    snapshot.capacity = max_size;
+    snapshot.bytes = queued_bytes;
+
+    Clock::duration fifo_time = lifo.fifo_time;
+    Clock::duration lifo_time = lifo.lifo_time;
+    if (lifo.enabled) {
+        (lifo.lifo ? lifo_time : fifo_time) += Clock::now() - lifo.since;
+    }
+    snapshot.fifo_time = std::chrono::duration_cast<std::chrono::nanoseconds>(fifo_time);
+    snapshot.lifo_time = std::chrono::duration_cast<std::chrono::nanoseconds>(lifo_time);
+    return snapshot;
 }
 
 /*****************************************************************************/
 
 /* Private Methods */
 
+template <typename T>
+bool Cola<T>::tracks_meta() const {
+    return codel.enabled || deadlines || lifo.enabled || budget.enabled;
+}
+
+template <typename T>
+void Cola<T>::start_tracking_meta() {
+    if (!tracks_meta()) {
+        meta.assign(buffer.size(), ItemMeta{Clock::now(), Clock::time_point::max(), 0});
+    }
+}
+
+template <typename T>
+bool Cola<T>::push_and_wake(T&& dato, Clock::time_point deadline, bool evict) {
+    std::vector<T> expired;
+    Wakers wakers;
+    bool accepted = false;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (deadline != Clock::time_point::max() && !deadlines) {
+            start_tracking_meta();
+            deadlines = true;
+        }
+        const bool was_empty = buffer.empty();
+        accepted = push_locked(std::move(dato), deadline, evict, expired);
+        publish_size();
+        wakers = collect_wakers(was_empty);
+    }
+    if (accepted) {
+        wake(wakers, false);
+    }
+    report_expired(expired);
+    report_watermark();
+    return accepted;
+}
+
+/**
+ * @details When the element does not fit and deadlines are in use,
+ *          expired elements are purged before evicting the oldest live
+ *          ones. An element larger than the whole byte budget is refused
+ *          even when evicting, since emptying the queue would not make it fit.
+ */
+template <typename T>
+bool Cola<T>::push_locked(T&& dato, Clock::time_point deadline, bool evict,
+                          std::vector<T>& expired) {
+    const Clock::time_point now = tracks_meta() ? Clock::now() : Clock::time_point();
+    const size_t bytes = budget.enabled ? budget.size_of(dato) : 0;
+    if (budget.enabled && bytes > budget.max_bytes) {
+        ++stats.rejected;
+        return false;
+    }
+    if (deadlines && !fits(bytes)) {
+        purge_expired(now, expired);
+    }
+    if (elastic.enabled && buffer.size() >= max_size) {
+        elastic_grow(buffer.size() + 1);
+    }
+    if (!fits(bytes)) {
+        if (!evict) {
+            ++stats.rejected;
+            return false;
+        }
+        while (!buffer.empty() && !fits(bytes)) {
+            discard_front();  // Take out the eldest "dato"
+            ++stats.evicted;
+        }
+    }
+
+    buffer.push_back(std::move(dato));
+    elastic.peak = std::max(elastic.peak, buffer.size());
+    if (tracks_meta()) {
+        if (deadline == Clock::time_point::max() && ttl > Clock::duration::zero()) {
+            deadline = now + ttl;
+        }
+        meta.push_back(ItemMeta{now, deadline, bytes});
+        queued_bytes += bytes;
+    }
+    ++stats.pushed;
+    if (lifo.enabled) {
+        update_lifo(now);
+    }
+    return true;
+}
+
+/**
+ * @details The level only changes state when it crosses the watermark on
+ *          the far side of the current one, which gives the hysteresis.
+ */
+template <typename T>
+void Cola<T>::publish_size() {
+    approx_size.store(buffer.size(), std::memory_order_relaxed);
+    if (!watermarks.enabled) {
+        return;
+    }
+    const size_t level = budget.enabled ? queued_bytes : buffer.size();
+    const bool above = above_high.load(std::memory_order_relaxed);
+    if (!above && level >= watermarks.high) {
+        above_high.store(true, std::memory_order_release);
+    } else if (above && level <= watermarks.low) {
+        above_high.store(false, std::memory_order_release);
+    }
+}
+
+template <typename T>
+bool Cola<T>::fits(size_t bytes) const {
+    return buffer.size() < max_size &&
+           (!budget.enabled || queued_bytes + bytes <= budget.max_bytes);
+}
+
+/**
+ * @details Elements are copied or moved in (depending on Source), without
+ *          per-element metadata when no CoDel, deadline, adaptive LIFO or
+ *          byte budget is in use: for trivially copyable T that is at most
+ *          two memcpy calls. Otherwise they go through the same path as push().
+ */
+template <typename T>
+template <typename Source>
+void Cola<T>::push_bulk_from(Source items, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    std::vector<T> expired;
+    Wakers wakers;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        const bool was_empty = buffer.empty();
+        if (tracks_meta()) {
+            for (size_t i = 0; i < count; ++i) {
+                push_locked(T(items[i]), Clock::time_point::max(), true, expired);
+            }
+        } else {
+            if (elastic.enabled) {
+                elastic_grow(buffer.size() + count);
+            }
+            // Only the newest max_size elements can remain, as with repeated push()
+            const size_t skipped = count > max_size ? count - max_size : 0;
+            const size_t added = count - skipped;
+            const size_t evicted =
+                buffer.size() + added > max_size ? buffer.size() + added - max_size : 0;
+            buffer.drop_front(evicted);
+            buffer.push_back_n(items + skipped, added);
+            stats.evicted += skipped + evicted;
+            stats.pushed += count;
+            elastic.peak = std::max(elastic.peak, buffer.size());
+        }
+        publish_size();
+        wakers = collect_wakers(was_empty);
+    }
+    wake(wakers, count > 1);
+    report_expired(expired);
+    report_watermark();
+}
+
+template <typename T>
+typename Cola<T>::Wakers Cola<T>::collect_wakers(bool was_empty) const {
+    Wakers wakers;
+    wakers.notifier = notifier;
+#if defined(__linux__)
+    if (was_empty) {
+        wakers.event_fd = event_fd;
+    }
+#else
+    (void)was_empty;
+#endif
+    return wakers;
+}
+
+/**
+ * @details Waiters are woken outside the lock. The event fd, if any, is
+ *          only signalled on the empty to non-empty transition: while the
+ *          queue is non-empty its consumer is still draining it.
+ */
+template <typename T>
+void Cola<T>::wake(const Wakers& wakers, bool all) {
+    if (all) {
+        not_empty.notify_all();
+    } else {
+        not_empty.notify();  // notify the waiting worker
+    }
+    if (wakers.notifier) {
+        wakers.notifier->notify();
+    }
+#if defined(__linux__)
+    if (wakers.event_fd) {
+        wakers.event_fd->signal();
+    }
+#endif
+}
+
+/**
+ * @details Wait until new data is added or until time is out; if only
+ *          expired data arrived, keep waiting for the rest of the timeout.
+ */
+template <typename T>
+template <typename Take>
+bool Cola<T>::wait_until_taken(Take take, Clock::time_point until) {
+    if (take()) {
+        return true;
+    }
+    while (true) {
+        const EventCount::Key key = not_empty.prepare_wait();
+        if (take()) {
+            not_empty.cancel_wait();
+            return true;
+        }
+        if (!not_empty.commit_wait(key, until)) {
+            return false;
+        }
+    }
+}
+
+template <typename T>
+size_t Cola<T>::try_take_bulk(T* out, size_t max_count, std::vector<T>& expired) {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t taken = 0;
+    if (!tracks_meta()) {
+        taken = std::min(buffer.size(), max_count);
+        buffer.pop_front_n(out, taken);
+        stats.popped += taken;
+        if (elastic.enabled) {
+            elastic_on_pop(taken);
+        }
+    } else {
+        while (taken < max_count && !buffer.empty() &&
+               take_locked(expired, [out, taken](T&& dato) { out[taken] = std::move(dato); })) {
+            ++taken;
+        }
+    }
+    publish_size();
+    return taken;
+}
+
+template <typename T>
+bool Cola<T>::try_take(nonstd::optional<T>& out, std::vector<T>& expired) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (buffer.empty()) {
+        return false;
+    }
+    const bool taken = take_locked(expired, [&out](T&& dato) { out.emplace(std::move(dato)); });
+    publish_size();
+    return taken;
+}
+
+/**
+ * @details The element is handed to `sink` while still in the buffer, so
+ *          the caller decides where it is moved to (exactly once).
+ */
+template <typename T>
+template <typename Sink>
+bool Cola<T>::take_locked(std::vector<T>& expired, Sink sink) {
+    const Clock::time_point now = tracks_meta() ? Clock::now() : Clock::time_point();
+    if (lifo.enabled) {
+        update_lifo(now);
+    }
+    if (deadlines) {
+        skip_expired(now, lifo.lifo, expired);
+        if (buffer.empty()) {
+            return false;
+        }
+    }
+    if (codel.enabled) {
+        codel_dequeue(now);
+    }
+
+    if (lifo.lifo) {
+        sink(std::move(buffer.back()));
+        discard_back();
+    } else {
+        sink(std::move(buffer.front()));
+        discard_front();
+    }
+    ++stats.popped;
+    if (lifo.enabled) {
+        update_lifo(now);
+    }
+    if (elastic.enabled) {
+        elastic_on_pop(1);
+    }
+    return true;
+}
+
+template <typename T>
+void Cola<T>::purge_expired(Clock::time_point now, std::vector<T>& expired) {
+    size_t kept = 0;
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        if (meta[i].deadline <= now) {
+            expired.push_back(std::move(buffer[i]));
+            queued_bytes -= meta[i].bytes;
+        } else if (kept != i) {
+            buffer[kept] = std::move(buffer[i]);
+            meta[kept] = meta[i];
+            ++kept;
+        } else {
+            ++kept;
+        }
+    }
+    stats.expired += buffer.size() - kept;
+    buffer.truncate(kept);
+    meta.erase(meta.begin() + static_cast<std::ptrdiff_t>(kept), meta.end());
+}
+
+template <typename T>
+void Cola<T>::skip_expired(Clock::time_point now, bool from_back, std::vector<T>& expired) {
+    while (!buffer.empty()) {
+        if (from_back && meta.back().deadline <= now) {
+            expired.push_back(std::move(buffer.back()));
+            discard_back();
+        } else if (!from_back && meta.front().deadline <= now) {
+            expired.push_back(std::move(buffer.front()));
+            discard_front();
+        } else {
+            break;
+        }
+        ++stats.expired;
+    }
+}
+
+/**
+ * @details The callback is copied under the lock, so it may be replaced
+ *          concurrently, and invoked without it, so it may use the queue.
+ */
+template <typename T>
+void Cola<T>::report_expired(std::vector<T>& expired) {
+    if (expired.empty()) {
+        return;
+    }
+    ExpiryCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        callback = on_expired;
+    }
+    if (!callback) {
+        return;
+    }
+    for (T& dato : expired) {
+        callback(std::move(dato));
+    }
+}
+
+/**
+ * @details Threads may observe crossings in a different order than they
+ *          happened, so the callback is not handed the crossing a thread
+ *          saw: under watermark_mtx the current state is compared with the
+ *          last one reported. Calls thus alternate and end on the latest
+ *          state. The fast path is two relaxed loads when nothing changed.
+ *
+ *          The callback runs on a copy taken under watermark_mtx, with the
+ *          lock released, so it may use the queue. A thread finding another
+ *          one delivering (possibly itself, from inside the callback) leaves
+ *          the change to it: the deliverer re-checks the state under the
+ *          lock before giving up that role, so no change is lost.
+ */
+template <typename T>
+void Cola<T>::report_watermark() {
+    if (above_high.load(std::memory_order_relaxed) ==
+        reported_high.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(watermark_mtx);
+    if (delivering_watermark) {
+        return;
+    }
+    delivering_watermark = true;
+    for (;;) {
+        const bool state = above_high.load(std::memory_order_acquire);
+        if (state == reported_high.load(std::memory_order_relaxed)) {
+            break;
+        }
+        reported_high.store(state, std::memory_order_relaxed);
+        const WatermarkCallback callback = on_watermark;
+        lock.unlock();
+        if (callback) {
+            callback(state);
+        }
+        lock.lock();
+    }
+    delivering_watermark = false;
+}
+
+/**
+ * @details A drop is allowed once the head sojourn has stayed above target
+ *          for a full interval. A queue holding a single element is never
+ *          considered a standing queue.
+ */
+template <typename T>
+bool Cola<T>::codel_ok_to_drop(Clock::time_point now) {
+    const Clock::duration sojourn = now - meta.front().enqueued;
+    if (sojourn < codel.target || buffer.size() <= 1) {
+        codel.first_above_time = Clock::time_point();
+        return false;
+    }
+    if (codel.first_above_time == Clock::time_point()) {
+        codel.first_above_time = now + codel.interval;
+        return false;
+    }
+    return now >= codel.first_above_time;
+}
+
+/**
+ * @details Dequeue side of RFC 8289. In dropping state, head elements are
+ *          dropped every interval / sqrt(count) until the sojourn falls
+ *          below target. Re-entering the dropping state shortly after
+ *          leaving it resumes the previous drop rate.
+ */
+template <typename T>
+void Cola<T>::codel_dequeue(Clock::time_point now) {
+    bool ok_to_drop = codel_ok_to_drop(now);
+
+    if (codel.dropping) {
+        if (!ok_to_drop) {
+            codel.dropping = false;
+        }
+        while (codel.dropping && now >= codel.drop_next) {
+            discard_front();
+            ++stats.codel_dropped;
+            ++codel.count;
+            ok_to_drop = codel_ok_to_drop(now);
+            if (!ok_to_drop) {
+                codel.dropping = false;
+            } else {
+                codel.drop_next = codel_control_law(codel.drop_next);
+            }
+        }
+    } else if (ok_to_drop) {
+        discard_front();
+        ++stats.codel_dropped;
+        codel_ok_to_drop(now);
+        codel.dropping = true;
+
+        const uint32_t delta = codel.count - codel.last_count;
+        const bool recent = now - codel.drop_next < 16 * codel.interval;
+        codel.count = (delta > 1 && recent) ? delta : 1;
+        codel.drop_next = codel_control_law(now);
+        codel.last_count = codel.count;
+    }
+}
+
+template <typename T>
+typename Cola<T>::Clock::time_point Cola<T>::codel_control_law(Clock::time_point t) const {
+    const double scaled = static_cast<double>(codel.interval.count()) / std::sqrt(codel.count);
+    return t + Clock::duration(static_cast<Clock::duration::rep>(scaled));
+}
+
+template <typename T>
+void Cola<T>::update_lifo(Clock::time_point now) {
+    bool next = false;
+    if (lifo.lifo) {
+        next = !buffer.empty();
+    } else if (!buffer.empty()) {
+        const bool deep = lifo.depth > 0 && buffer.size() >= lifo.depth;
+        const bool stale =
+            lifo.sojourn > Clock::duration::zero() && now - meta.front().enqueued >= lifo.sojourn;
+        next = deep || stale;
+    }
+    if (next == lifo.lifo) {
+        return;
+    }
+
+    (lifo.lifo ? lifo.lifo_time : lifo.fifo_time) += now - lifo.since;
+    lifo.since = now;
+    lifo.lifo = next;
+    if (next) {
+        ++stats.lifo_switches;
+    }
+}
+
+template <typename T>
+void Cola<T>::elastic_grow(size_t needed) {
+    size_t grown = std::max<size_t>(max_size, 1);
+    while (grown < needed && grown < elastic.upper) {
+        grown *= 2;
+    }
+    grown = std::min(grown, elastic.upper);
+    if (grown > max_size) {
+        max_size = grown;
+        ++stats.capacity_grows;
+    }
+}
+
+/**
+ * @details A window lasts as many pops as the capacity, so a full queue
+ *          must drain and stay low for a while before shrinking. Growing
+ *          at full and shrinking at a quarter leaves a gap between both
+ *          thresholds, so the capacity does not oscillate around one size.
+ *          The shrunk ring copies at most a quarter of the old capacity.
+ */
+template <typename T>
+void Cola<T>::elastic_on_pop(size_t count) {
+    elastic.popped += count;
+    if (elastic.popped < max_size) {
+        return;
+    }
+    if (elastic.peak <= max_size / 4 && max_size > elastic.lower) {
+        max_size = std::max(elastic.lower, max_size / 2);
+        buffer.shrink(max_size);
+        ++stats.capacity_shrinks;
+    }
+    elastic.popped = 0;
+    elastic.peak = buffer.size();
+}
+
+template <typename T>
+void Cola<T>::apply_capacity(size_t capacity) {
+    max_size = capacity;
+    while (buffer.size() > max_size) {
+        discard_front();
+        ++stats.evicted;
+    }
+    buffer.shrink(max_size);
+    publish_size();
+}
+
+template <typename T>
+void Cola<T>::discard_front() {
+    buffer.pop_front();
+    if (!meta.empty()) {
+        queued_bytes -= meta.front().bytes;
+        meta.pop_front();
+    }
+}
+
+template <typename T>
+void Cola<T>::discard_back() {
+    buffer.pop_back();
+    if (!meta.empty()) {
+        queued_bytes -= meta.back().bytes;
+        meta.pop_back();
+    }
+}
+
 /*****************************************************************************/
\ No newline at end of file
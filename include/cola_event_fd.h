@@ -0,0 +1,122 @@
+/**
+ * @file        cola_event_fd.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Linux eventfd signalled when a queue receives data.
+ *
+ * @details
+ * `ColaEventFd` lets a thread running an epoll (or poll/select) loop
+ * consume a `Cola<T>` without blocking in `pop`. A queue with an attached
+ * event fd signals it when it goes from empty to non-empty; the file
+ * descriptor then becomes readable and can be registered alongside
+ * sockets.
+ *
+ * Wake-ups are coalesced: once signalled, the descriptor is not written
+ * again until the consumer calls `clear()`, so a busy producer performs at
+ * most one `write` per consumer wake-up. The consumer must call `clear()`
+ * before draining the queue with `try_pop()` until it returns no value:
+ * @code
+ *   if (events & EPOLLIN) {
+ *       event_fd->clear();
+ *       while (auto dato = cola.try_pop()) { ... }
+ *   }
+ * @endcode
+ *
+ * One event fd may be shared by several queues. Only available on Linux.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+#if defined(__linux__)
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/**
+ * @class ColaEventFd
+ * @brief Non-blocking eventfd with coalesced signalling.
+ */
+class ColaEventFd {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the ColaEventFd class.
+     * @throw std::runtime_error if the eventfd cannot be created.
+     */
+    ColaEventFd();
+
+    /**
+     * @brief Destructor of the ColaEventFd class. Closes the descriptor.
+     */
+    ~ColaEventFd();
+
+    /**
+     * @brief Disable copy constructor.
+     *        The instance owns a file descriptor.
+     */
+    ColaEventFd(const ColaEventFd&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ColaEventFd& operator=(const ColaEventFd&) = delete;
+
+    /**
+     * @brief File descriptor to register with epoll (readable when signalled).
+     */
+    int fd() const;
+
+    /**
+     * @brief Make the descriptor readable, unless it already is.
+     */
+    void signal();
+
+    /**
+     * @brief Consume the pending signal. Call it before draining the queues.
+     */
+    void clear();
+
+    /**
+     * @brief Number of writes issued to the descriptor so far.
+     */
+    uint64_t get_writes() const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief eventfd descriptor.
+     */
+    int handle;
+
+    /**
+     * @brief Set from the first signal() until clear().
+     */
+    std::atomic<bool> armed;
+
+    /**
+     * @brief Statistics.
+     */
+    std::atomic<uint64_t> writes;
+
+    /******************************************************************/
+};
+
+#endif  // defined(__linux__)
@@ -0,0 +1,163 @@
+/**
+ * @file        cola_producer.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Per-thread batching producer handle for Cola<T>.
+ *
+ * @details
+ * With many producer threads pushing one element at a time, the queue
+ * mutex becomes the bottleneck. A `ColaProducer<T>` is owned by a single
+ * producer thread (e.g. a `thread_local` or a local of the producer loop)
+ * and accumulates elements in a private buffer, touching no shared state.
+ * They are published with a single `Cola<T>::push_bulk()` call, so the
+ * queue lock is taken once per batch:
+ * - when the batch reaches its size limit,
+ * - on the first push after the oldest pending element has waited the
+ *   maximum delay, or when `flush_if_due()` finds it has,
+ * - on `flush()` and on destruction.
+ *
+ * Pending elements are not visible to consumers. The delay bound only
+ * holds while the thread keeps pushing or calls `flush_if_due()` (e.g.
+ * from its idle path), since the handle has no timer thread of its own.
+ * Elements are pushed without deadlines.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ColaProducer
+ * @brief Batches the pushes of one producer thread into bulk pushes.
+ * @tparam T Type of elements stored in the queue.
+ */
+template <typename T>
+class ColaProducer {
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Default number of elements per batch.
+     */
+    static constexpr size_t DEFAULT_BATCH_SIZE = 32;
+
+    /**
+     * @brief Default maximum time an element waits in the batch.
+     */
+    static constexpr std::chrono::microseconds DEFAULT_MAX_DELAY{100};
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+    /**
+     * @brief Construct a producer handle for a queue.
+     * @param cola Queue receiving the batches; must outlive the handle.
+     * @param batch_size Number of pending elements that triggers a flush (at least 1).
+     * @param max_delay Age of the oldest pending element that triggers a flush.
+     */
+    explicit ColaProducer(Cola<T>& cola, size_t batch_size = DEFAULT_BATCH_SIZE,
+                          std::chrono::microseconds max_delay = DEFAULT_MAX_DELAY);
+
+    /**
+     * @brief Destructor of the ColaProducer class. Flushes pending elements;
+     *        if that throws, the exception is swallowed and they are lost.
+     */
+    ~ColaProducer();
+
+    /**
+     * @brief Disable copy constructor.
+     *        Two handles sharing pending elements would publish them twice.
+     */
+    ColaProducer(const ColaProducer&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ColaProducer& operator=(const ColaProducer&) = delete;
+
+    /**
+     * @brief Add an element to the batch, flushing it when full or due.
+     * @param dato Data to insert.
+     */
+    void push(T dato);
+
+    /**
+     * @brief Publish the pending elements now.
+     */
+    void flush();
+
+    /**
+     * @brief Publish the pending elements if the oldest has waited the maximum delay.
+     * @return true if a flush happened.
+     */
+    bool flush_if_due();
+
+    /**
+     * @brief Number of elements not yet published.
+     */
+    size_t pending_count(void) const;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+   private:
+    /**
+     * @brief Clock used for the batch age.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    /**
+     * @brief Queue receiving the batches.
+     */
+    Cola<T>& cola;
+
+    /**
+     * @brief Elements not yet published, oldest first.
+     */
+    std::vector<T> pending;
+
+    /**
+     * @brief Number of pending elements that triggers a flush.
+     */
+    size_t batch_size;
+
+    /**
+     * @brief Age of the oldest pending element that triggers a flush.
+     */
+    Clock::duration max_delay;
+
+    /**
+     * @brief When the oldest pending element was added.
+     */
+    Clock::time_point oldest;
+
+    /******************************************************************/
+};
+
+#include "cola_producer.ipp"
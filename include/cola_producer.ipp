@@ -0,0 +1,95 @@
+/**
+ * @file        cola_producer.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class ColaProducer<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <utility>
+
+/* Project libraries */
+
+#include "cola_producer.h"
+
+// Definition required for odr-used static constexpr data members (C++14)
+template <typename T>
+constexpr size_t ColaProducer<T>::DEFAULT_BATCH_SIZE;
+
+template <typename T>
+constexpr std::chrono::microseconds ColaProducer<T>::DEFAULT_MAX_DELAY;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+ColaProducer<T>::ColaProducer(Cola<T>& cola, size_t batch_size,
+                              std::chrono::microseconds max_delay)
+    : cola(cola), batch_size(std::max<size_t>(batch_size, 1)), max_delay(max_delay) {
+    pending.reserve(this->batch_size);
+}
+
+/**
+ * @details flush() may throw (allocation in the queue, user callbacks), and
+ *          an exception leaving a destructor calls std::terminate, so it is
+ *          swallowed here and the batch is lost. Call flush() explicitly
+ *          to observe such errors.
+ */
+template <typename T>
+ColaProducer<T>::~ColaProducer() {
+    try {
+        flush();
+    } catch (...) {
+        pending.clear();
+    }
+}
+
+/**
+ * @details The clock is read once per push: to stamp the first element of
+ *          a batch, or to check the age of the oldest one.
+ */
+template <typename T>
+void ColaProducer<T>::push(T dato) {
+    const Clock::time_point now = Clock::now();
+    if (pending.empty()) {
+        oldest = now;
+    }
+    pending.push_back(std::move(dato));
+    if (pending.size() >= batch_size || now - oldest >= max_delay) {
+        flush();
+    }
+}
+
+/**
+ * @details push_bulk() moves the elements out and leaves the vector empty
+ *          with its capacity, so the next batch does not allocate.
+ */
+template <typename T>
+void ColaProducer<T>::flush() {
+    if (!pending.empty()) {
+        cola.push_bulk(std::move(pending));
+    }
+}
+
+template <typename T>
+bool ColaProducer<T>::flush_if_due() {
+    if (pending.empty() || Clock::now() - oldest < max_delay) {
+        return false;
+    }
+    flush();
+    return true;
+}
+
+template <typename T>
+size_t ColaProducer<T>::pending_count(void) const {
+    return pending.size();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,201 @@
+/**
+ * @file        cola_selector.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Single-consumer view over several queues.
+ *
+ * @details
+ * `ColaSelector<T>` lets one consumer take elements from several `Cola<T>`
+ * without polling each of them in turn with a timeout:
+ * - Every added queue signals an event count shared by the selector on
+ *   each push, so `pop` sleeps once on it and wakes up as soon as any of
+ *   the queues receives data.
+ * - With `Policy::STRICT_PRIORITY` the queues are tried in the order they
+ *   were added; a later queue is only served while all earlier ones are
+ *   empty.
+ * - With `Policy::WEIGHTED` the queues are served round robin, each one
+ *   taking up to its weight in elements per turn; empty queues lose the
+ *   rest of their turn.
+ *
+ * The queues must outlive the selector. It exposes the same `pop(timeout)`
+ * as `Cola<T>` and can be consumed by a `Worker<T, ColaSelector<T>>`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "cola.h"
+#include "event_count.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ColaSelector
+ * @brief Waits on several queues at once and picks the next one to serve.
+ * @tparam T Type of elements stored in the queues.
+ */
+template <typename T>
+class ColaSelector {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief How the next queue is chosen when several have data.
+     */
+    enum class Policy {
+        STRICT_PRIORITY, /**< First non-empty queue in insertion order. */
+        WEIGHTED         /**< Round robin, weight elements per turn. */
+    };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the ColaSelector class.
+     * @param policy Selection policy, by default strict priority.
+     */
+    explicit ColaSelector(Policy policy = Policy::STRICT_PRIORITY);
+
+    /**
+     * @brief Destructor of the ColaSelector class.
+     */
+    ~ColaSelector() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        The selector owns a mutex, which is non-copyable.
+     */
+    ColaSelector(const ColaSelector&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ColaSelector& operator=(const ColaSelector&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     *        The added queues keep signalling the notifier of this instance.
+     */
+    ColaSelector(ColaSelector&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    ColaSelector& operator=(ColaSelector&&) = delete;
+
+    /**
+     * @brief Add a queue to the selection. Replaces any notifier attached to
+     *        it (see Cola::attach_notifier()), so a queue must not be added
+     *        to two selectors: the first one would no longer be woken.
+     * @param cola Queue to consume from; must outlive the selector.
+     * @param weight Elements per turn with Policy::WEIGHTED (at least 1).
+     */
+    void add(Cola<T>& cola, uint32_t weight = 1);
+
+    /**
+     * @brief Removes the next element according to the policy, waiting up
+     *        to a timeout for any queue to receive data.
+     * @param timeout Maximum time to wait for data.
+     * @return The element, or `nonstd::nullopt` if the timeout expires without data.
+     */
+    nonstd::optional<T> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Removes the next element according to the policy without waiting.
+     * @return The element, or `nonstd::nullopt` if every queue is empty.
+     */
+    nonstd::optional<T> try_pop();
+
+    /**
+     * @brief Getter of the number of elements queued in all the queues.
+     */
+    size_t get_size(void) const;
+
+    /**
+     * @brief Indicates if every queue is empty.
+     */
+    bool is_empty(void) const;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+   private:
+    /**
+     * @struct Source
+     * @brief One of the selected queues.
+     */
+    struct Source {
+        Cola<T>* cola;   /**< Selected queue. */
+        uint32_t weight; /**< Elements per turn. */
+        uint32_t credit; /**< Elements left in the current turn. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Move the weighted turn to the next source (mtx held).
+     */
+    void next_turn();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Selected queues, in insertion (priority) order.
+     */
+    std::vector<Source> sources;
+
+    /**
+     * @brief Selection policy.
+     */
+    Policy policy;
+
+    /**
+     * @brief Source whose turn it is with Policy::WEIGHTED.
+     */
+    size_t cursor;
+
+    /**
+     * @brief Notifier signalled by every selected queue.
+     */
+    std::shared_ptr<EventCount> notifier;
+
+    /**
+     * @brief Protects sources and cursor.
+     */
+    mutable std::mutex mtx;
+
+    /******************************************************************/
+};
+
+#include "cola_selector.ipp"
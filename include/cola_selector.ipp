@@ -0,0 +1,157 @@
+/**
+ * @file        cola_selector.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class ColaSelector<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+
+/* Project libraries */
+
+#include "cola_selector.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+ColaSelector<T>::ColaSelector(Policy policy)
+    : policy(policy), cursor(0), notifier(std::make_shared<EventCount>()) {}
+
+template <typename T>
+void ColaSelector<T>::add(Cola<T>& cola, uint32_t weight) {
+    weight = std::max<uint32_t>(weight, 1);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        sources.push_back(Source{&cola, weight, weight});
+    }
+    cola.attach_notifier(notifier);
+    notifier->notify_all();  // Wake a pop() already waiting, the queue may hold data
+}
+
+/**
+ * @details The selector registers as a waiter before polling the queues a
+ *          second time: a push landing after that poll advances the event
+ *          count, so the wait returns at once instead of missing it.
+ */
+template <typename T>
+nonstd::optional<T> ColaSelector<T>::pop(std::chrono::seconds timeout) {
+    const std::chrono::steady_clock::time_point until = std::chrono::steady_clock::now() + timeout;
+    nonstd::optional<T> out = try_pop();
+    while (!out) {
+        const EventCount::Key key = notifier->prepare_wait();
+        out = try_pop();
+        if (out) {
+            notifier->cancel_wait();
+            break;
+        }
+        if (!notifier->commit_wait(key, until)) {
+            break;
+        }
+    }
+    return out;
+}
+
+/**
+ * @details With Policy::WEIGHTED a full cycle visits every source once with
+ *          fresh credit (the current one may have none left), so n + 1
+ *          visits are enough to find any queued element.
+ *
+ *          The source is picked under mtx, but Cola::try_pop() runs after
+ *          releasing it, since it may call the queue's expiry and watermark
+ *          callbacks and those may use the selector. Sources are only ever
+ *          appended, so an index stays valid; the turn is only charged if
+ *          no nested call moved it meanwhile.
+ */
+template <typename T>
+nonstd::optional<T> ColaSelector<T>::try_pop() {
+    if (policy == Policy::STRICT_PRIORITY) {
+        for (size_t index = 0;; ++index) {
+            Cola<T>* cola;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (index >= sources.size()) {
+                    return nonstd::nullopt;
+                }
+                cola = sources[index].cola;
+            }
+            nonstd::optional<T> out = cola->try_pop();
+            if (out) {
+                return out;
+            }
+        }
+    }
+
+    for (size_t visited = 0;; ++visited) {
+        Cola<T>* cola;
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (sources.empty() || visited > sources.size()) {
+                return nonstd::nullopt;
+            }
+            if (sources[cursor].credit == 0) {
+                next_turn();
+                continue;
+            }
+            index = cursor;
+            cola = sources[index].cola;
+        }
+        nonstd::optional<T> out = cola->try_pop();
+        std::lock_guard<std::mutex> lock(mtx);
+        if (cursor != index || sources[index].credit == 0) {
+            if (out) {
+                return out;  // A nested call already moved the turn
+            }
+            continue;
+        }
+        if (out) {
+            if (--sources[index].credit == 0) {
+                next_turn();
+            }
+            return out;
+        }
+        next_turn();  // Empty: idle queues do not keep their turn
+    }
+}
+
+template <typename T>
+size_t ColaSelector<T>::get_size(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t size = 0;
+    for (const Source& source : sources) {
+        size += source.cola->get_size();
+    }
+    return size;
+}
+
+template <typename T>
+bool ColaSelector<T>::is_empty(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (const Source& source : sources) {
+        if (!source.cola->is_empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T>
+void ColaSelector<T>::next_turn() {
+    sources[cursor].credit = 0;
+    cursor = (cursor + 1) % sources.size();
+    sources[cursor].credit = sources[cursor].weight;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,233 @@
+/**
+ * @file        cola_storage.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Element storage of Cola<T>, specialized for trivially copyable T.
+ *
+ * @details
+ * `ColaStorage<T>` is the double-ended sequence behind `Cola<T>`:
+ * - For general T it is a `std::deque<T>`.
+ * - For trivially copyable T it is a ring buffer over raw memory: no
+ *   per-block allocation, no destructor calls, and bulk transfers are one
+ *   or two `memcpy` calls (two when the range wraps around the end).
+ *   The ring grows by doubling; `Cola` bounds it by its maximum size and
+ *   releases memory with `shrink` when that size is lowered.
+ *
+ * Both expose the same interface, so `Cola` is written once. The storage
+ * is not synchronized; `Cola` only uses it with its mutex held.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*****************************************************************************/
+
+/**
+ * @class ColaStorage
+ * @brief Generic storage: a std::deque<T>.
+ * @tparam T Element type.
+ * @tparam Trivial Whether T is trivially copyable (selects the ring buffer).
+ */
+template <typename T, bool Trivial = std::is_trivially_copyable<T>::value>
+class ColaStorage {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Single-element operations, as in std::deque.
+     */
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    T& front() { return items.front(); }
+    T& back() { return items.back(); }
+    T& operator[](size_t i) { return items[i]; }
+    void push_back(T&& dato) { items.push_back(std::move(dato)); }
+    void pop_front() { items.pop_front(); }
+    void pop_back() { items.pop_back(); }
+
+    /**
+     * @brief Remove the n oldest elements.
+     */
+    void drop_front(size_t n);
+
+    /**
+     * @brief Keep only the n oldest elements.
+     */
+    void truncate(size_t n);
+
+    /**
+     * @brief Append n elements, copied from in (moved if in is a std::move_iterator).
+     */
+    template <typename Source>
+    void push_back_n(Source in, size_t n);
+
+    /**
+     * @brief Move the n oldest elements into out[0..n) and remove them.
+     */
+    void pop_front_n(T* out, size_t n);
+
+    /**
+     * @brief Release unused memory (n is ignored; std::deque frees whole blocks).
+     */
+    void shrink(size_t) { items.shrink_to_fit(); }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Elements, oldest first.
+     */
+    std::deque<T> items;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class ColaStorage<T, true>
+ * @brief Ring buffer storage for trivially copyable T.
+ * @tparam T Element type.
+ */
+template <typename T>
+class ColaStorage<T, true> {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the ring storage. Allocates on first push.
+     */
+    ColaStorage();
+
+    /**
+     * @brief Single-element operations, as in std::deque.
+     */
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& front() { return *at(0); }
+    T& back() { return *at(count - 1); }
+    T& operator[](size_t i) { return *at(i); }
+    void push_back(T&& dato);
+    void pop_front();
+    void pop_back() { --count; }
+
+    /**
+     * @brief Remove the n oldest elements.
+     */
+    void drop_front(size_t n);
+
+    /**
+     * @brief Keep only the n oldest elements.
+     */
+    void truncate(size_t n) { count = n; }
+
+    /**
+     * @brief Append n elements with at most two memcpy calls.
+     */
+    void push_back_n(const T* in, size_t n);
+
+    /**
+     * @brief Append n elements; moving a trivially copyable T is a copy.
+     */
+    void push_back_n(std::move_iterator<T*> in, size_t n) { push_back_n(in.base(), n); }
+
+    /**
+     * @brief Copy the n oldest elements into out[0..n) with at most two
+     *        memcpy calls and remove them.
+     */
+    void pop_front_n(T* out, size_t n);
+
+    /**
+     * @brief Reallocate to the smallest ring holding max(n, size()) elements,
+     *        if that is smaller than the current one.
+     */
+    void shrink(size_t n);
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Capacity of the first allocation.
+     */
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    /**
+     * @brief Uninitialized memory for one element.
+     */
+    using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Address of the i-th oldest element.
+     */
+    T* at(size_t i);
+
+    /**
+     * @brief Grow (doubling) until n elements fit.
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief Move the elements to a new ring of the given number of slots.
+     */
+    void reallocate(size_t slot_count);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    /**
+     * @brief Ring memory; the capacity is a power of two.
+     */
+    std::unique_ptr<Slot[]> slots;
+
+    /**
+     * @brief Number of slots, 0 before the first push.
+     */
+    size_t capacity;
+
+    /**
+     * @brief Index of the oldest element.
+     */
+    size_t head;
+
+    /**
+     * @brief Number of elements.
+     */
+    size_t count;
+
+    /******************************************************************/
+};
+
+#include "cola_storage.ipp"
@@ -0,0 +1,154 @@
+/**
+ * @file        cola_storage.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class ColaStorage<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+/* Project libraries */
+
+#include "cola_storage.h"
+
+// Definition required for odr-used static constexpr data members (C++14)
+template <typename T>
+constexpr size_t ColaStorage<T, true>::MIN_CAPACITY;
+
+/*****************************************************************************/
+
+/* Generic storage */
+
+template <typename T, bool Trivial>
+void ColaStorage<T, Trivial>::drop_front(size_t n) {
+    items.erase(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(n));
+}
+
+template <typename T, bool Trivial>
+void ColaStorage<T, Trivial>::truncate(size_t n) {
+    items.erase(items.begin() + static_cast<std::ptrdiff_t>(n), items.end());
+}
+
+template <typename T, bool Trivial>
+template <typename Source>
+void ColaStorage<T, Trivial>::push_back_n(Source in, size_t n) {
+    items.insert(items.end(), in, in + n);
+}
+
+template <typename T, bool Trivial>
+void ColaStorage<T, Trivial>::pop_front_n(T* out, size_t n) {
+    std::move(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(n), out);
+    drop_front(n);
+}
+
+/*****************************************************************************/
+
+/* Ring storage */
+
+template <typename T>
+ColaStorage<T, true>::ColaStorage() : capacity(0), head(0), count(0) {}
+
+template <typename T>
+void ColaStorage<T, true>::push_back(T&& dato) {
+    reserve(count + 1);
+    ::new (static_cast<void*>(at(count))) T(std::move(dato));
+    ++count;
+}
+
+template <typename T>
+void ColaStorage<T, true>::pop_front() {
+    head = (head + 1) & (capacity - 1);
+    --count;
+}
+
+template <typename T>
+void ColaStorage<T, true>::drop_front(size_t n) {
+    if (n > 0) {
+        head = (head + n) & (capacity - 1);
+        count -= n;
+    }
+}
+
+/**
+ * @details The free space starts after the newest element and may wrap
+ *          around the end of the ring: the part up to the end is filled
+ *          first, then the rest from slot 0.
+ */
+template <typename T>
+void ColaStorage<T, true>::push_back_n(const T* in, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    reserve(count + n);
+    const size_t tail = (head + count) & (capacity - 1);
+    const size_t first = std::min(n, capacity - tail);
+    std::memcpy(static_cast<void*>(&slots[tail]), in, first * sizeof(T));
+    std::memcpy(static_cast<void*>(&slots[0]), in + first, (n - first) * sizeof(T));
+    count += n;
+}
+
+template <typename T>
+void ColaStorage<T, true>::pop_front_n(T* out, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    const size_t first = std::min(n, capacity - head);
+    std::memcpy(static_cast<void*>(out), &slots[head], first * sizeof(T));
+    std::memcpy(static_cast<void*>(out + first), &slots[0], (n - first) * sizeof(T));
+    drop_front(n);
+}
+
+template <typename T>
+T* ColaStorage<T, true>::at(size_t i) {
+    return reinterpret_cast<T*>(&slots[(head + i) & (capacity - 1)]);
+}
+
+template <typename T>
+void ColaStorage<T, true>::reserve(size_t n) {
+    if (n <= capacity) {
+        return;
+    }
+    size_t grown = std::max(capacity, MIN_CAPACITY);
+    while (grown < n) {
+        grown *= 2;
+    }
+    reallocate(grown);
+}
+
+template <typename T>
+void ColaStorage<T, true>::shrink(size_t n) {
+    const size_t needed = std::max(n, count);
+    size_t shrunk = MIN_CAPACITY;
+    while (shrunk < needed) {
+        shrunk *= 2;
+    }
+    if (shrunk < capacity) {
+        reallocate(shrunk);
+    }
+}
+
+/**
+ * @details The elements are copied to the start of the new ring, oldest
+ *          first, so head restarts at 0.
+ */
+template <typename T>
+void ColaStorage<T, true>::reallocate(size_t slot_count) {
+    std::unique_ptr<Slot[]> replacement(new Slot[slot_count]);
+    const size_t kept = count;
+    pop_front_n(reinterpret_cast<T*>(replacement.get()), kept);
+    slots = std::move(replacement);
+    capacity = slot_count;
+    head = 0;
+    count = kept;
+}
+
+/*****************************************************************************/
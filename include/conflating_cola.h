@@ -0,0 +1,191 @@
+/**
+ * @file        conflating_cola.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Thread-safe bounded queue keeping only the latest value per key.
+ *
+ * @details
+ * `ConflatingCola<K, V>` is meant for state-update streams (prices, sensor
+ * readings...) where only the most recent value of each key matters.
+ * - Pushing a key that is already pending replaces its value in place;
+ *   the key keeps its FIFO position, so it is not starved by newer keys.
+ * - Pushing a new key into a full queue discards the oldest pending key.
+ * - `pop` returns the oldest pending key with its latest value, so a
+ *   consumer does at most one unit of work per key per drain cycle.
+ *
+ * It exposes the same `pop(timeout)` as `Cola<T>`, with
+ * `T = std::pair<K, V>`, and can be consumed by a `Worker`:
+ * `Worker<std::pair<K, V>, ConflatingCola<K, V>>`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/*****************************************************************************/
+
+/**
+ * @struct ConflatingColaStats
+ * @brief Snapshot of the counters of a ConflatingCola.
+ */
+struct ConflatingColaStats {
+    size_t size = 0;        /**< Keys currently pending. */
+    uint64_t pushed = 0;    /**< Updates accepted by push(). */
+    uint64_t popped = 0;    /**< Keys returned by pop(). */
+    uint64_t conflated = 0; /**< Updates that replaced a pending value. */
+    uint64_t evicted = 0;   /**< Oldest keys dropped on a full push(). */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class ConflatingCola
+ * @brief Thread-safe bounded queue of keys, each holding its latest value.
+ * @tparam K Key type (hashable, copyable).
+ * @tparam V Value type.
+ * @tparam Hash Hash function of K.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class ConflatingCola {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief Element returned by pop(): a key and its latest value.
+     */
+    using value_type = std::pair<K, V>;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the ConflatingCola class.
+     * @param max_size Maximum number of pending keys, by default 5.
+     */
+    explicit ConflatingCola(size_t max_size = 5);
+
+    /**
+     * @brief Destructor of the ConflatingCola class.
+     */
+    ~ConflatingCola() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        The queue owns synchronization primitives, which are non-copyable.
+     */
+    ConflatingCola(const ConflatingCola&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    ConflatingCola& operator=(const ConflatingCola&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     *        Moving would transfer synchronization primitives between instances.
+     */
+    ConflatingCola(ConflatingCola&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    ConflatingCola& operator=(ConflatingCola&&) = delete;
+
+    /**
+     * @brief Publish the latest value of a key.
+     *        If the key is pending, its value is replaced and it keeps its
+     *        position; otherwise it is appended, discarding the oldest
+     *        pending key if the queue is full.
+     * @param key Key of the update.
+     * @param value New value.
+     */
+    void push(K key, V value);
+
+    /**
+     * @brief Removes the oldest pending key, waiting up to a timeout.
+     * @param timeout Maximum time to wait for data.
+     * @return The key and its latest value, or `nonstd::nullopt` if the
+     *         timeout expires without data.
+     */
+    nonstd::optional<value_type> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Getter of the number of pending keys.
+     */
+    size_t get_size(void) const;
+
+    /**
+     * @brief Indicates if no key is pending.
+     */
+    bool is_empty(void) const;
+
+    /**
+     * @brief Getter of the queue counters.
+     * @return A consistent snapshot of the statistics.
+     */
+    ConflatingColaStats get_stats(void) const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Pending keys, oldest first.
+     */
+    std::deque<K> order;
+
+    /**
+     * @brief Latest value of each pending key.
+     */
+    std::unordered_map<K, V, Hash> values;
+
+    /**
+     * @brief Mutex.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Condition variable.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Maximum number of pending keys.
+     */
+    size_t max_size;
+
+    /**
+     * @brief Counters (size is filled in by get_stats()).
+     */
+    ConflatingColaStats stats;
+
+    /******************************************************************/
+};
+
+#include "conflating_cola.ipp"
@@ -0,0 +1,89 @@
+/**
+ * @file        conflating_cola.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class ConflatingCola<K, V>.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "conflating_cola.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename K, typename V, typename Hash>
+ConflatingCola<K, V, Hash>::ConflatingCola(size_t max_size) : max_size(max_size) {}
+
+/**
+ * @details A single hash lookup decides between replacing in place and
+ *          appending a new key.
+ */
+template <typename K, typename V, typename Hash>
+void ConflatingCola<K, V, Hash>::push(K key, V value) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++stats.pushed;
+
+        auto it = values.find(key);
+        if (it != values.end()) {
+            it->second = std::move(value);
+            ++stats.conflated;
+            return;  // Already pending: a consumer is or will be notified
+        }
+
+        if (order.size() >= max_size && !order.empty()) {
+            values.erase(order.front());  // Take out the eldest key
+            order.pop_front();
+            ++stats.evicted;
+        }
+        order.push_back(key);
+        values.emplace(std::move(key), std::move(value));
+    }
+    cv.notify_one();
+}
+
+template <typename K, typename V, typename Hash>
+nonstd::optional<typename ConflatingCola<K, V, Hash>::value_type> ConflatingCola<K, V, Hash>::pop(
+    std::chrono::seconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Wait until new data is added or until time is out
+    if (!cv.wait_for(lock, timeout, [this] { return !order.empty(); })) {
+        return nonstd::nullopt;
+    }
+
+    auto it = values.find(order.front());
+    value_type out(std::move(order.front()), std::move(it->second));
+    values.erase(it);
+    order.pop_front();
+    ++stats.popped;
+    return out;
+}
+
+template <typename K, typename V, typename Hash>
+size_t ConflatingCola<K, V, Hash>::get_size(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return order.size();
+}
+
+template <typename K, typename V, typename Hash>
+bool ConflatingCola<K, V, Hash>::is_empty(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return order.empty();
+}
+
+template <typename K, typename V, typename Hash>
+ConflatingColaStats ConflatingCola<K, V, Hash>::get_stats(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    ConflatingColaStats snapshot = stats;
+    snapshot.size = order.size();
+    return snapshot;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,59 @@
+/**
+ * @file        console_sink.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Log sink writing to the standard output stream.
+ *
+ * @details
+ * This is the Logger's default destination. Each record is written and
+ * flushed under a mutex so lines from different threads never interleave.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <mutex>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class ConsoleSink
+ * @brief Writes records to std::cout.
+ */
+class ConsoleSink : public ILogSink {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Write the record to std::cout and flush it.
+     * @param record The formatted record.
+     */
+    void write(const LogRecord& record) override;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Serializes access to std::cout.
+     */
+    std::mutex mtx;
+
+    /******************************************************************/
+};
@@ -0,0 +1,253 @@
+/**
+ * @file        edf_cola.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Thread-safe bounded earliest-deadline-first queue.
+ *
+ * @details
+ * `EdfCola<T>` pops the element with the nearest deadline instead of the
+ * oldest one (ties are served in push order).
+ * - The ordering is kept in a 4-ary min-heap stored in a flat vector of
+ *   small nodes (deadline, push sequence, slot); the elements themselves
+ *   live in a separate slot array and never move while queued. A 4-ary
+ *   heap is half as deep as a binary one and the four children of a node
+ *   are contiguous, so sifting touches fewer cache lines.
+ * - When the queue is full, a push first evicts an element whose deadline
+ *   has already been missed (the root, if it is late); otherwise the
+ *   element with the farthest deadline is evicted, unless the new element
+ *   is farther still, in which case the new one is rejected.
+ *
+ * It exposes the same `pop(timeout)` as `Cola<T>` and can be consumed by
+ * a `Worker<T, EdfCola<T>>`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/*****************************************************************************/
+
+/**
+ * @struct EdfColaStats
+ * @brief Snapshot of the counters of an EdfCola.
+ */
+struct EdfColaStats {
+    size_t size = 0;       /**< Elements currently queued. */
+    uint64_t pushed = 0;   /**< Elements accepted by push(). */
+    uint64_t popped = 0;   /**< Elements returned by pop(). */
+    uint64_t late = 0;     /**< Elements returned by pop() after their deadline. */
+    uint64_t evicted = 0;  /**< Queued elements dropped to make room. */
+    uint64_t rejected = 0; /**< Pushes refused: full, with the farthest deadline. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class EdfCola
+ * @brief Thread-safe bounded queue ordered by deadline.
+ * @tparam T Type of elements stored in the queue.
+ */
+template <typename T>
+class EdfCola {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief Clock of the deadlines.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the EdfCola class.
+     * @param max_size Maximum number of elements, by default 5.
+     */
+    explicit EdfCola(size_t max_size = 5);
+
+    /**
+     * @brief Destructor of the EdfCola class.
+     */
+    ~EdfCola() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        The queue owns synchronization primitives, which are non-copyable.
+     */
+    EdfCola(const EdfCola&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    EdfCola& operator=(const EdfCola&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     *        Moving would transfer synchronization primitives between instances.
+     */
+    EdfCola(EdfCola&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    EdfCola& operator=(EdfCola&&) = delete;
+
+    /**
+     * @brief Push an element with its deadline.
+     *        If the queue is full, a late element or the one with the
+     *        farthest deadline is evicted (see the class description).
+     * @param dato Data to insert.
+     * @param deadline Time by which the element should be processed.
+     * @return false if the element was rejected.
+     */
+    bool push(T dato, Clock::time_point deadline);
+
+    /**
+     * @brief Removes the element with the nearest deadline, waiting up to a timeout.
+     *        Late elements are still returned (and counted as late).
+     * @param timeout Maximum time to wait for data.
+     * @return The element, or `nonstd::nullopt` if the timeout expires without data.
+     */
+    nonstd::optional<T> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Getter of the number of queued elements.
+     */
+    size_t get_size(void) const;
+
+    /**
+     * @brief Indicates if the queue is empty.
+     */
+    bool is_empty(void) const;
+
+    /**
+     * @brief Getter of the queue counters.
+     * @return A consistent snapshot of the statistics.
+     */
+    EdfColaStats get_stats(void) const;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Children per heap node.
+     */
+    static constexpr size_t ARITY = 4;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    /**
+     * @struct Node
+     * @brief Heap node: ordering key and location of the element.
+     */
+    struct Node {
+        Clock::time_point deadline; /**< Deadline of the element. */
+        uint64_t seq;               /**< Push order, breaks deadline ties. */
+        size_t slot;                /**< Index of the element in slots. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Heap order: earlier deadline first, then earlier push.
+     */
+    static bool before(const Node& a, const Node& b);
+
+    /**
+     * @brief Move heap[i] up until its parent is before it.
+     */
+    void sift_up(size_t i);
+
+    /**
+     * @brief Move heap[i] down until it is before all its children.
+     */
+    void sift_down(size_t i);
+
+    /**
+     * @brief Index of the node with the farthest deadline (a leaf).
+     */
+    size_t farthest() const;
+
+    /**
+     * @brief Remove heap[i] and free its slot, returning the element.
+     */
+    T remove_at(size_t i);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief 4-ary min-heap of nodes.
+     */
+    std::vector<Node> heap;
+
+    /**
+     * @brief Element storage, indexed by Node::slot.
+     */
+    std::vector<nonstd::optional<T>> slots;
+
+    /**
+     * @brief Unused indices of slots.
+     */
+    std::vector<size_t> free_slots;
+
+    /**
+     * @brief Next push sequence number.
+     */
+    uint64_t next_seq;
+
+    /**
+     * @brief Mutex.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Condition variable.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Maximum number of elements.
+     */
+    size_t max_size;
+
+    /**
+     * @brief Counters (size is filled in by get_stats()).
+     */
+    EdfColaStats stats;
+
+    /******************************************************************/
+};
+
+#include "edf_cola.ipp"
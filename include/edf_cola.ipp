@@ -0,0 +1,191 @@
+/**
+ * @file        edf_cola.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class EdfCola<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <utility>
+
+/* Project libraries */
+
+#include "edf_cola.h"
+
+// Definition required for odr-used static constexpr data members (C++14)
+template <typename T>
+constexpr size_t EdfCola<T>::ARITY;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+EdfCola<T>::EdfCola(size_t max_size) : next_seq(0), max_size(max_size) {
+    heap.reserve(max_size);
+    slots.reserve(max_size);
+}
+
+template <typename T>
+bool EdfCola<T>::push(T dato, Clock::time_point deadline) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (heap.size() >= max_size) {
+            if (heap.empty()) {
+                ++stats.rejected;
+                return false;
+            }
+            if (heap.front().deadline < Clock::now()) {
+                remove_at(0);  // Already missed: the least useful element
+            } else {
+                const size_t victim = farthest();
+                if (deadline >= heap[victim].deadline) {
+                    ++stats.rejected;
+                    return false;
+                }
+                remove_at(victim);
+            }
+            ++stats.evicted;
+        }
+
+        size_t slot = slots.size();
+        if (!free_slots.empty()) {
+            slot = free_slots.back();
+            free_slots.pop_back();
+            slots[slot] = std::move(dato);
+        } else {
+            slots.emplace_back(std::move(dato));
+        }
+        heap.push_back(Node{deadline, next_seq++, slot});
+        sift_up(heap.size() - 1);
+        ++stats.pushed;
+    }
+    cv.notify_one();
+    return true;
+}
+
+template <typename T>
+nonstd::optional<T> EdfCola<T>::pop(std::chrono::seconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Wait until new data is added or until time is out
+    if (!cv.wait_for(lock, timeout, [this] { return !heap.empty(); })) {
+        return nonstd::nullopt;
+    }
+
+    if (heap.front().deadline < Clock::now()) {
+        ++stats.late;
+    }
+    ++stats.popped;
+    return remove_at(0);
+}
+
+template <typename T>
+size_t EdfCola<T>::get_size(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return heap.size();
+}
+
+template <typename T>
+bool EdfCola<T>::is_empty(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return heap.empty();
+}
+
+template <typename T>
+EdfColaStats EdfCola<T>::get_stats(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    EdfColaStats snapshot = stats;
+    snapshot.size = heap.size();
+    return snapshot;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T>
+bool EdfCola<T>::before(const Node& a, const Node& b) {
+    return a.deadline < b.deadline || (a.deadline == b.deadline && a.seq < b.seq);
+}
+
+template <typename T>
+void EdfCola<T>::sift_up(size_t i) {
+    const Node node = heap[i];
+    while (i > 0) {
+        const size_t parent = (i - 1) / ARITY;
+        if (!before(node, heap[parent])) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = node;
+}
+
+template <typename T>
+void EdfCola<T>::sift_down(size_t i) {
+    const size_t n = heap.size();
+    const Node node = heap[i];
+    while (true) {
+        const size_t first = i * ARITY + 1;
+        if (first >= n) {
+            break;
+        }
+        const size_t last = std::min(first + ARITY, n);
+        size_t best = first;
+        for (size_t c = first + 1; c < last; ++c) {
+            if (before(heap[c], heap[best])) {
+                best = c;
+            }
+        }
+        if (!before(heap[best], node)) {
+            break;
+        }
+        heap[i] = heap[best];
+        i = best;
+    }
+    heap[i] = node;
+}
+
+/**
+ * @details The maximum of a min-heap is a leaf; leaves start right after
+ *          the parent of the last node.
+ */
+template <typename T>
+size_t EdfCola<T>::farthest() const {
+    const size_t n = heap.size();
+    const size_t first_leaf = n > 1 ? (n - 2) / ARITY + 1 : 0;
+    size_t worst = first_leaf;
+    for (size_t i = first_leaf + 1; i < n; ++i) {
+        if (before(heap[worst], heap[i])) {
+            worst = i;
+        }
+    }
+    return worst;
+}
+
+template <typename T>
+T EdfCola<T>::remove_at(size_t i) {
+    const size_t slot = heap[i].slot;
+    T out = std::move(*slots[slot]);
+    slots[slot] = nonstd::nullopt;
+    free_slots.push_back(slot);
+
+    const Node last = heap.back();
+    heap.pop_back();
+    if (i < heap.size()) {
+        heap[i] = last;
+        sift_up(i);
+        sift_down(i);
+    }
+    return out;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ * @file        event_count.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Event count: blocking and wake-up primitive for queues.
+ *
+ * @details
+ * An `EventCount` lets a consumer sleep until a condition it checks
+ * without holding any lock (typically "some queue is not empty") may have
+ * become true:
+ * @code
+ *   while (true) {
+ *       if (try_take()) break;               // Fast path, no registration
+ *       EventCount::Key key = ec.prepare_wait();
+ *       if (try_take()) { ec.cancel_wait(); break; }
+ *       if (!ec.commit_wait(key, until)) break;  // Timed out
+ *   }
+ * @endcode
+ * and a producer calls `notify()` after making the condition true. A
+ * notification issued after `prepare_wait()` makes `commit_wait()` return
+ * at once, so no wake-up is lost between the check and the sleep.
+ *
+ * Compared to a mutex and condition variable:
+ * - `notify()` costs one atomic increment and one load when no consumer is
+ *   waiting; the wake-up system call is skipped entirely.
+ * - A woken consumer does not reacquire any mutex before re-checking.
+ *
+ * On Linux it sleeps on a futex over the epoch counter. Elsewhere it falls
+ * back to a mutex and condition variable, still skipping them when nobody
+ * waits.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+/*****************************************************************************/
+
+/**
+ * @class EventCount
+ * @brief Epoch counter with futex-based blocking wait.
+ */
+class EventCount {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief Epoch observed by prepare_wait().
+     */
+    using Key = uint32_t;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the EventCount class.
+     */
+    EventCount();
+
+    /**
+     * @brief Disable copy constructor.
+     *        Waiters sleep on the address of the epoch.
+     */
+    EventCount(const EventCount&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    EventCount& operator=(const EventCount&) = delete;
+
+    /**
+     * @brief Register as a waiter. Check the condition again afterwards,
+     *        then call either cancel_wait() or commit_wait().
+     * @return Key to pass to commit_wait().
+     */
+    Key prepare_wait();
+
+    /**
+     * @brief Unregister after prepare_wait(), when the condition became true.
+     */
+    void cancel_wait();
+
+    /**
+     * @brief Sleep until a notification newer than `key` or a deadline.
+     *        Unregisters the waiter in both cases.
+     * @param key Value returned by prepare_wait().
+     * @param until Deadline of the wait.
+     * @return false if the deadline passed without a notification.
+     */
+    bool commit_wait(Key key, std::chrono::steady_clock::time_point until);
+
+    /**
+     * @brief Wake one waiter, if any.
+     */
+    void notify();
+
+    /**
+     * @brief Wake every waiter, if any.
+     */
+    void notify_all();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Advance the epoch and wake up to `count` sleepers.
+     */
+    void wake(int count);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Number of notifications so far (the futex word).
+     */
+    std::atomic<uint32_t> epoch;
+
+    /**
+     * @brief Consumers between prepare_wait() and cancel/commit_wait().
+     */
+    std::atomic<uint32_t> waiters;
+
+#if !defined(__linux__)
+    /**
+     * @brief Mutex of the condition variable (fallback).
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Condition variable (fallback).
+     */
+    std::condition_variable cv;
+#endif
+
+    /******************************************************************/
+};
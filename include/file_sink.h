@@ -0,0 +1,275 @@
+/**
+ * @file        file_sink.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Buffered, rotating file destination for the Logger.
+ *
+ * @details
+ * `FileSink` accumulates formatted log records in a large user-space
+ * buffer and hands full buffers to a background thread, which appends
+ * them to the log file with a single `write()` per buffer (the file is
+ * opened with `O_APPEND`). Rotation by size and/or by time is performed
+ * by the same background thread, so callers of `write()` never perform
+ * I/O and never wait for the disk.
+ *
+ * If the background thread falls behind and the amount of pending data
+ * exceeds a configurable limit, new records are dropped (and counted)
+ * rather than blocking the caller.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class FileSink
+ * @brief Asynchronous buffered file writer with size/time based rotation.
+ *
+ * Rotated files are renamed `path.1`, `path.2`, ... up to `max_files`,
+ * `path.1` being the most recent one.
+ */
+class FileSink : public ILogSink {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @struct Options
+     * @brief Configuration of a FileSink.
+     */
+    struct Options {
+        /** Path of the active log file. */
+        std::string path;
+
+        /** Size of each user-space buffer handed to the writer thread. */
+        size_t buffer_size = 1 << 20;
+
+        /** Maximum amount of buffered bytes before records are dropped. */
+        size_t max_pending_bytes = 64u << 20;
+
+        /** Rotate when the file exceeds this size (0 disables size rotation). */
+        uint64_t max_file_size = 0;
+
+        /** Rotate after this interval (0 disables time rotation). */
+        std::chrono::seconds rotation_interval{0};
+
+        /** Number of rotated files kept besides the active one. */
+        size_t max_files = 5;
+
+        /** Maximum time a record stays in the buffer before being written. */
+        std::chrono::milliseconds flush_interval{200};
+    };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Open (or create) the log file and start the writer thread.
+     * @param options Sink configuration.
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    explicit FileSink(const Options& options);
+
+    /**
+     * @brief Flush all pending data, stop the writer thread and close the file.
+     */
+    ~FileSink() override;
+
+    /**
+     * @brief Disable copy constructor.
+     *        A FileSink owns a file descriptor and a writer thread.
+     */
+    FileSink(const FileSink&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    FileSink& operator=(const FileSink&) = delete;
+
+    /**
+     * @brief Append a formatted record to the current buffer.
+     * @param record The record delivered by the Logger.
+     */
+    void write(const LogRecord& record) override;
+
+    /**
+     * @brief Append data to the current buffer.
+     *        Never performs I/O; full buffers are handed to the writer thread.
+     * @param data Pointer to the bytes to append (normally one formatted record).
+     * @param len Number of bytes.
+     */
+    void write(const char* data, size_t len);
+
+    /**
+     * @brief Block until everything appended so far has been written to the file.
+     */
+    void flush();
+
+    /**
+     * @brief Number of bytes written to disk since construction.
+     */
+    uint64_t bytes_written() const;
+
+    /**
+     * @brief Number of bytes dropped because the writer thread fell behind.
+     */
+    uint64_t bytes_dropped() const;
+
+    /**
+     * @brief Number of rotations performed since construction.
+     */
+    uint64_t rotations() const;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Writer thread loop.
+     */
+    void run();
+
+    /**
+     * @brief Write a whole buffer to the file, rotating beforehand if needed.
+     * @param buf Buffer to write.
+     */
+    void write_buffer(const std::vector<char>& buf);
+
+    /**
+     * @brief Close the active file, shift the rotated ones and reopen.
+     */
+    void rotate();
+
+    /**
+     * @brief Open the active file in append mode and refresh its size.
+     */
+    void open_file();
+
+    /**
+     * @brief Close the active file if open.
+     */
+    void close_file();
+
+    /**
+     * @brief Move the active buffer to the pending list (lock must be held).
+     */
+    void seal_active_locked();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Sink configuration.
+     */
+    Options options;
+
+    /**
+     * @brief Protects the buffers and the writer thread state.
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Wakes the writer thread.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Signals completed writes to flush() callers.
+     */
+    std::condition_variable flushed_cv;
+
+    /**
+     * @brief Buffer currently being filled by callers.
+     */
+    std::vector<char> active;
+
+    /**
+     * @brief Sealed buffers waiting to be written.
+     */
+    std::deque<std::vector<char>> pending;
+
+    /**
+     * @brief Recycled buffers, kept to avoid reallocating.
+     */
+    std::vector<std::vector<char>> spare;
+
+    /**
+     * @brief Bytes sealed or buffered but not yet written.
+     */
+    size_t pending_bytes;
+
+    /**
+     * @brief Sequence number of the last sealed buffer.
+     */
+    uint64_t sealed_seq;
+
+    /**
+     * @brief Sequence number of the last buffer written to disk.
+     */
+    uint64_t written_seq;
+
+    /**
+     * @brief Set when the writer thread must exit.
+     */
+    bool stopping;
+
+    /**
+     * @brief File descriptor of the active file (-1 when closed).
+     */
+    int fd;
+
+    /**
+     * @brief Size of the active file.
+     */
+    uint64_t file_size;
+
+    /**
+     * @brief Time of the next time-based rotation.
+     */
+    std::chrono::steady_clock::time_point next_rotation;
+
+    /**
+     * @brief Statistics.
+     */
+    std::atomic<uint64_t> written_total;
+    std::atomic<uint64_t> dropped_total;
+    std::atomic<uint64_t> rotation_count;
+
+    /**
+     * @brief Background writer thread.
+     */
+    std::thread writer;
+
+    /******************************************************************/
+};
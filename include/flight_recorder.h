@@ -0,0 +1,135 @@
+/**
+ * @file        flight_recorder.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       In-memory ring of recent log records, dumped on demand or on crash.
+ *
+ * @details
+ * While started, the FlightRecorder receives every Logger record at or
+ * above its capture level, including DEBUG records that no sink would
+ * print. Each thread writes into its own fixed-size ring, so capturing
+ * a record is a single memcpy with no lock, no allocation and no I/O;
+ * the record is not even formatted.
+ *
+ * The rings can be written to a file at any time with `dump()`. After
+ * `install_signal_handlers()`, they are also dumped on SIGUSR1 and on
+ * fatal signals (SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT). The dump path
+ * only uses async-signal-safe calls.
+ *
+ * Each slot is protected by a sequence counter (seqlock), so a dump taken
+ * while threads keep logging skips slots being overwritten instead of
+ * emitting torn records. Messages longer than TEXT_CAPACITY are truncated.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class FlightRecorder
+ * @brief Static, lock-free, per-thread capture of recent log records.
+ */
+class FlightRecorder {
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Maximum number of message bytes kept per record.
+     */
+    static constexpr size_t TEXT_CAPACITY = 232;
+
+    /**
+     * @brief Maximum number of thread rings.
+     *        Threads beyond this limit (while all rings are owned) are not captured.
+     */
+    static constexpr size_t MAX_THREADS = 256;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Start capturing Logger records.
+     * @param records_per_thread Ring size of each thread. Only applies to
+     *        rings created after the first start.
+     * @param lvl Lowest level captured, by default every level.
+     */
+    static void start(size_t records_per_thread = 4096, LogLevel lvl = LogLevel::DBG);
+
+    /**
+     * @brief Stop capturing. Records already captured are kept and can still be dumped.
+     */
+    static void stop();
+
+    /**
+     * @brief Store a record in the calling thread's ring.
+     * @param lvl Severity level.
+     * @param msg Message text (not formatted).
+     * @param len Message length.
+     */
+    static void record(LogLevel lvl, const char* msg, size_t len);
+
+    /**
+     * @brief Write every captured record to a file, overwriting it.
+     * @param path Destination file.
+     * @return true if the file could be written.
+     * @note Async-signal-safe.
+     */
+    static bool dump(const char* path);
+
+    /**
+     * @brief Dump to `path` on SIGUSR1 and on fatal signals.
+     *        Fatal signals are re-raised with the default action after the dump.
+     * @param path Destination file (copied).
+     * @return false if signals are not supported on this platform or the
+     *         path is too long.
+     */
+    static bool install_signal_handlers(const std::string& path);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Dump every ring to an open file descriptor.
+     */
+    static void dump_fd(int fd);
+
+    /**
+     * @brief Signal handler installed by install_signal_handlers().
+     */
+    static void on_signal(int sig);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    static std::atomic<bool> active;             /**< Capture enabled. */
+    static std::atomic<size_t> ringCapacity;     /**< Slots of newly created rings. */
+    static char signalDumpPath[512];             /**< Dump path used by the handler. */
+
+    /******************************************************************/
+};
@@ -12,6 +12,11 @@
  * shutdown, and notifying lifecycle end (stop).
  *
  * This interface is templated to support any element type (Cola<T>).
+ *
+ * Long-running actions can override `trabajo_cancelable`, which also
+ * receives a `StopToken`, and poll it (or register a callback on it) to
+ * abort early when the Worker is stopping. It returns whether the element
+ * was completed; by default it forwards to `trabajo` and returns true.
  */
 
 /*****************************************************************************/
@@ -25,6 +30,11 @@
 /* Standard libraries */
 
 #include <chrono>
+#include <string>
+
+/* Project libraries */
+
+#include "stop_token.h"
 
 /*****************************************************************************/
 
@@ -53,6 +63,36 @@ class IWorkerAction {
      */
     virtual void trabajo(const std::string& workerName, const T& dato) = 0;
 
+    /**
+     * @brief Action executed when data is successfully retrieved, with a
+     *        token signalled when the worker is asked to stop.
+     *        This is the one the Worker calls; by default it ignores the
+     *        token and completes the element with trabajo().
+     * @param workerName Name of the worker invoking the callback.
+     * @param dato Data retrieved from the queue.
+     * @param stop Stop token of the worker; poll it to return early.
+     * @return true if the element was completed, false if it was abandoned.
+     */
+    virtual bool trabajo_cancelable(const std::string& workerName, const T& dato,
+                                    StopToken stop) {
+        (void)stop;
+        trabajo(workerName, dato);
+        return true;
+    }
+
+    /**
+     * @brief Called when trabajo_cancelable() returns false, i.e. the
+     *        element was cut short (normally because of a stop request), or
+     *        instead of it when the stop came after the element was taken
+     *        from the queue but before the action started.
+     * @param workerName Name of the worker invoking the callback.
+     * @param dato Element that was abandoned.
+     */
+    virtual void onAbandoned(const std::string& workerName, const T& dato) {
+        (void)workerName;
+        (void)dato;
+    }
+
     /**
      * @brief Action executed when the queue is empty after timeout.
      * @param workerName Name of the worker invoking the callback.
@@ -0,0 +1,135 @@
+/**
+ * @file        intrusive_mpsc_queue.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Intrusive lock-free multi-producer single-consumer queue.
+ *
+ * @details
+ * `IntrusiveMpscQueue<T>` is Dmitry Vyukov's unbounded MPSC queue. The
+ * link pointer lives inside the user's node (`T` derives from `MpscNode`),
+ * so neither push nor pop allocates:
+ * - `push` is wait-free: one atomic exchange on the head and one store.
+ * - `try_pop` is lock-free and must only be called by one consumer thread.
+ *   It may return nullptr for a short window while a producer is between
+ *   its exchange and its store; the element becomes visible once that
+ *   producer finishes.
+ *
+ * The queue never owns the nodes: they must stay alive until popped, and
+ * a node must not be pushed again before it has been popped.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <type_traits>
+
+/*****************************************************************************/
+
+/**
+ * @struct MpscNode
+ * @brief Link embedded in the elements of an IntrusiveMpscQueue.
+ */
+struct MpscNode {
+    std::atomic<MpscNode*> next{nullptr}; /**< Next node towards the head. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class IntrusiveMpscQueue
+ * @brief Unbounded lock-free queue of nodes linked through MpscNode.
+ * @tparam T Element type, deriving from MpscNode.
+ */
+template <typename T>
+class IntrusiveMpscQueue {
+    static_assert(std::is_base_of<MpscNode, T>::value, "T must derive from MpscNode");
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the IntrusiveMpscQueue class.
+     */
+    IntrusiveMpscQueue();
+
+    /**
+     * @brief Destructor of the IntrusiveMpscQueue class.
+     *        Nodes still queued are not touched.
+     */
+    ~IntrusiveMpscQueue() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        Queued nodes point into this instance (stub node).
+     */
+    IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    IntrusiveMpscQueue& operator=(const IntrusiveMpscQueue&) = delete;
+
+    /**
+     * @brief Append a node. Safe from any number of threads.
+     * @param node Node to append; must not be queued already.
+     */
+    void push(T* node);
+
+    /**
+     * @brief Remove the oldest node. Single consumer only.
+     * @return The node, or nullptr if the queue is empty (or a push is
+     *         half-way through, see the file description).
+     */
+    T* try_pop();
+
+    /**
+     * @brief Whether no node is visible to the consumer. Single consumer only.
+     */
+    bool is_empty() const;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Link a node (user node or stub) after the current head.
+     */
+    void push_node(MpscNode* node);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Last pushed node; producers exchange it.
+     */
+    std::atomic<MpscNode*> head;
+
+    /**
+     * @brief Oldest node; only the consumer touches it.
+     */
+    MpscNode* tail;
+
+    /**
+     * @brief Placeholder keeping the list non-empty when no node is queued.
+     */
+    MpscNode stub;
+
+    /******************************************************************/
+};
+
+#include "intrusive_mpsc_queue.ipp"
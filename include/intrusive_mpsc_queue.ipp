@@ -0,0 +1,79 @@
+/**
+ * @file        intrusive_mpsc_queue.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class IntrusiveMpscQueue<T>.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "intrusive_mpsc_queue.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+IntrusiveMpscQueue<T>::IntrusiveMpscQueue() : head(&stub), tail(&stub) {}
+
+template <typename T>
+void IntrusiveMpscQueue<T>::push(T* node) {
+    push_node(node);
+}
+
+/**
+ * @details The stub is skipped when it reaches the tail. The last real
+ *          node can only be returned once another node follows it, so
+ *          when it is alone the stub is pushed behind it first.
+ */
+template <typename T>
+T* IntrusiveMpscQueue<T>::try_pop() {
+    MpscNode* first = tail;
+    MpscNode* next = first->next.load(std::memory_order_acquire);
+    if (first == &stub) {
+        if (next == nullptr) {
+            return nullptr;
+        }
+        tail = next;
+        first = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+        tail = next;
+        return static_cast<T*>(first);
+    }
+
+    // first looks like the last node: make sure no producer is linking after it
+    if (first != head.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    push_node(&stub);
+    next = first->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        tail = next;
+        return static_cast<T*>(first);
+    }
+    return nullptr;
+}
+
+template <typename T>
+bool IntrusiveMpscQueue<T>::is_empty() const {
+    return tail == &stub && stub.next.load(std::memory_order_acquire) == nullptr;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T>
+void IntrusiveMpscQueue<T>::push_node(MpscNode* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    MpscNode* prev = head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+/*****************************************************************************/
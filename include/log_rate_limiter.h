@@ -0,0 +1,163 @@
+/**
+ * @file        log_rate_limiter.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free rate limiter for repetitive log statements.
+ *
+ * @details
+ * A `LogRateLimiter` lets at most N records through per time window and
+ * counts the ones it rejects. The next record that gets through carries
+ * the number of records suppressed since the previous one, so the output
+ * shows "suppressed K similar messages" instead of K copies.
+ *
+ * A site that bursts and then goes quiet has no next record to carry its
+ * count. Every limiter is therefore registered, and `flush_pending()`
+ * reports the counts of sites whose window has ended (or of every site,
+ * on shutdown). The Logger calls it on its own records; when nothing is
+ * pending that costs one atomic load.
+ *
+ * The `LOG_*_LIMITED` macros in logger.h create one limiter per call site
+ * (a function-local static), so independent statements never throttle
+ * each other. All counters are atomics: rejected records never touch the
+ * Logger or its sinks.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class LogRateLimiter
+ * @brief Fixed-window limiter with a suppressed-records counter.
+ *
+ * Under contention a window reset may race with concurrent increments,
+ * so the limit is approximate (a window may admit a few extra records).
+ */
+class LogRateLimiter {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Receives the pending count of a site in flush_pending().
+     * @param level Level of the site's records.
+     * @param site Call site, as given to the constructor.
+     * @param suppressed Records suppressed since the last accepted one.
+     */
+    using PendingHandler = void (*)(LogLevel level, const char* site, uint64_t suppressed);
+
+    /**
+     * @brief Constructor of the LogRateLimiter class. Registers the limiter
+     *        for flush_pending().
+     * @param max_per_interval Records allowed per window.
+     * @param interval Window length.
+     * @param level Level of the site's records.
+     * @param site Call site ("file:line"); must outlive the limiter.
+     */
+    LogRateLimiter(uint32_t max_per_interval, std::chrono::milliseconds interval,
+                   LogLevel level = LogLevel::WARN, const char* site = "");
+
+    /**
+     * @brief Destructor of the LogRateLimiter class. Unregisters the limiter.
+     */
+    ~LogRateLimiter();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    LogRateLimiter(const LogRateLimiter&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+
+    /**
+     * @brief Decide whether a record may be emitted.
+     * @param suppressed Set to the number of records rejected since the
+     *        previous accepted one (only meaningful when returning true).
+     * @return true if the record should be logged.
+     */
+    bool allow(uint64_t& suppressed);
+
+    /**
+     * @brief Hand the pending suppressed counts to `handler` and clear them.
+     *        Returns at once (one atomic load) while no window with a
+     *        pending count has ended. The handler runs without any lock held.
+     * @param handler Receives each site with a non-zero count.
+     * @param all Also report sites whose window is still open (shutdown).
+     */
+    static void flush_pending(PendingHandler handler, bool all = false);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Make flush_pending() look at the limiters once `due` is reached.
+     * @param due Steady-clock ticks.
+     */
+    static void schedule_flush(std::chrono::steady_clock::rep due);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Records allowed per window.
+     */
+    const uint32_t max_per_interval;
+
+    /**
+     * @brief Window length in steady-clock ticks.
+     */
+    const std::chrono::steady_clock::rep interval;
+
+    /**
+     * @brief Start of the current window, in steady-clock ticks.
+     */
+    std::atomic<std::chrono::steady_clock::rep> window_start;
+
+    /**
+     * @brief Records seen in the current window.
+     */
+    std::atomic<uint64_t> count;
+
+    /**
+     * @brief Records rejected since the last accepted one.
+     */
+    std::atomic<uint64_t> suppressed_count;
+
+    /**
+     * @brief Level of the site's records.
+     */
+    const LogLevel level;
+
+    /**
+     * @brief Call site, reported by flush_pending().
+     */
+    const char* const site;
+
+    /******************************************************************/
+};
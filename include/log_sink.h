@@ -0,0 +1,75 @@
+/**
+ * @file        log_sink.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Abstract destination for Logger records.
+ *
+ * @details
+ * A sink receives records that the Logger has already formatted. The
+ * Logger formats each record once and fans it out to every registered
+ * sink whose level threshold accepts it, so sinks only decide where the
+ * bytes go (console, file, memory, network, ...).
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+
+/*****************************************************************************/
+
+/**
+ * @enum LogLevel
+ * @brief Severity levels for log messages.
+ */
+enum class LogLevel {
+    DBG = 0,  /**< Debug messages, most verbose. */
+    INFO = 1, /**< Informational messages about normal operation. */
+    WARN = 2, /**< Warning messages indicating potential issues. */
+    ERROR = 3 /**< Error messages indicating failures. */
+};
+
+/**
+ * @struct LogRecord
+ * @brief A formatted log record as delivered to sinks.
+ *
+ * The text is only valid for the duration of the `ILogSink::write()` call.
+ */
+struct LogRecord {
+    LogLevel level;   /**< Severity of the record. */
+    const char* data; /**< Complete line, "[timestamp] [LEVEL] message\n". */
+    size_t size;      /**< Number of bytes in data. */
+};
+
+/**
+ * @class ILogSink
+ * @brief Abstract interface for log destinations.
+ *
+ * Implementations must be thread-safe: `write()` may be called
+ * concurrently from every thread that logs.
+ */
+class ILogSink {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    virtual ~ILogSink() = default;
+
+    /**
+     * @brief Deliver a formatted record to the destination.
+     * @param record The record; its text is not retained by the Logger.
+     */
+    virtual void write(const LogRecord& record) = 0;
+
+    /******************************************************************/
+};
@@ -7,16 +7,32 @@
  * @brief       Thread-safe logging utility with levels.
  *
  * @details
- * The Logger class provides a global, thread-safe mechanism to print
- * messages to the standard output stream. Messages are categorized by
- * severity levels (INFO, WARN, ERROR), and a configurable minimum level
- * filter determines which messages are displayed.
+ * The Logger class provides a global, thread-safe mechanism to emit
+ * messages. Messages are categorized by severity levels (DEBUG, INFO,
+ * WARN, ERROR), and a configurable minimum level filter determines which
+ * messages are displayed.
  *
- * Internally, the Logger uses a static mutex to synchronize concurrent
- * writes from multiple threads, ensuring that log messages are not
- * interleaved. It also attaches a timestamp and the severity label to
- * each printed message, providing clear context for debugging and
- * monitoring concurrent applications.
+ * Each record is formatted once, with a timestamp and the severity label,
+ * and fanned out to every registered sink (`ILogSink`) whose own level
+ * threshold accepts it. By default a single `ConsoleSink` writing to
+ * std::cout is registered.
+ *
+ * The sink list is published copy-on-write, so logging never takes the
+ * Logger mutex; it is only used to serialize configuration changes. The
+ * combined threshold of the global level and all sinks is cached in an
+ * atomic, so a record that no sink wants costs a single load.
+ *
+ * While the FlightRecorder is started, records at or above its capture
+ * level are also stored in its in-memory rings, even when no sink
+ * accepts them.
+ *
+ * Call sites should prefer the `LOG_DEBUG`/`LOG_INFO`/`LOG_WARN`/`LOG_ERROR`
+ * macros: the message expression is only evaluated when the level is
+ * enabled, and levels below `LOGGER_COMPILE_MIN_LEVEL` (set with the
+ * `LOG_COMPILE_MIN_LEVEL` CMake option) are removed from the binary.
+ * The `LOG_*_LIMITED` variants additionally rate-limit each call site and
+ * report how many similar records were suppressed, with the site's next
+ * record or, if it went quiet, once its window ends (`flush_suppressed()`).
  */
 
 /*****************************************************************************/
@@ -29,8 +45,31 @@
 
 /* Standard libraries */
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
+
+/* Project libraries */
+
+#include "log_rate_limiter.h"
+#include "log_sink.h"
+#include "value_format.h"
+
+/*****************************************************************************/
+
+/* Compile-time level */
+
+/**
+ * @brief Lowest level compiled into the binary (0 = DEBUG ... 3 = ERROR).
+ *        Normally provided by the build system.
+ */
+#ifndef LOGGER_COMPILE_MIN_LEVEL
+#define LOGGER_COMPILE_MIN_LEVEL 0
+#endif
 
 /*****************************************************************************/
 
@@ -45,15 +84,9 @@ class Logger {
 
    public:
     /**
-     * @enum Level
-     * @brief Severity levels for log messages.
+     * @brief Severity levels for log messages (see LogLevel).
      */
-    enum class Level {
-        DBG = 0,  /**< Debug messages, most verbose. */
-        INFO = 1, /**< Informational messages about normal operation. */
-        WARN = 2, /**< Warning messages indicating potential issues. */
-        ERROR = 3 /**< Error messages indicating failures. */
-    };
+    using Level = LogLevel;
 
     /******************************************************************/
 
@@ -66,6 +99,64 @@ class Logger {
      */
     static void set_min_level(Level lvl);
 
+    /**
+     * @brief Register a sink.
+     * @param sink The sink receiving formatted records.
+     * @param lvl Minimum level delivered to this sink, by default every level
+     *        that passes the global minimum level.
+     */
+    static void add_sink(std::shared_ptr<ILogSink> sink, Level lvl = Level::DBG);
+
+    /**
+     * @brief Unregister a sink. Records already being delivered may still reach it.
+     * @param sink The sink to remove.
+     */
+    static void remove_sink(const std::shared_ptr<ILogSink>& sink);
+
+    /**
+     * @brief Change the level threshold of a registered sink.
+     * @param sink The sink to update.
+     * @param lvl New minimum level for that sink.
+     */
+    static void set_sink_level(const std::shared_ptr<ILogSink>& sink, Level lvl);
+
+    /**
+     * @brief Unregister every sink, including the default console sink.
+     */
+    static void clear_sinks();
+
+    /**
+     * @brief Pass records at or above a level to the FlightRecorder,
+     *        regardless of the sink thresholds. Called by FlightRecorder::start().
+     * @param lvl Lowest captured level.
+     */
+    static void enable_capture(Level lvl);
+
+    /**
+     * @brief Stop passing records to the FlightRecorder.
+     */
+    static void disable_capture();
+
+    /**
+     * @brief Check whether a level is compiled into the binary.
+     * @param lvl Severity level.
+     * @return true if lvl is at or above LOGGER_COMPILE_MIN_LEVEL.
+     */
+    static constexpr bool compiled_in(Level lvl) {
+        return static_cast<int>(lvl) >= LOGGER_COMPILE_MIN_LEVEL;
+    }
+
+    /**
+     * @brief Check whether a record of the given level would reach any sink
+     *        (or the FlightRecorder).
+     * @param lvl Severity level.
+     * @return true if at least one destination accepts the level.
+     */
+    static bool enabled(Level lvl) {
+        return compiled_in(lvl) &&
+               static_cast<int>(lvl) >= threshold.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Log a debug message.
      * @param msg The message to log.
@@ -97,16 +188,82 @@ class Logger {
      */
     static void log(Level lvl, const std::string& msg);
 
+    /**
+     * @brief Log a message held in a caller-provided buffer.
+     * @param lvl Severity level of the message.
+     * @param msg The message (not necessarily NUL-terminated).
+     * @param len Length of the message.
+     */
+    static void log(Level lvl, const char* msg, size_t len);
+
+    /**
+     * @brief Log a message built in a FormatBuffer, without allocating.
+     * @param lvl Severity level of the message.
+     * @param msg The formatted message.
+     */
+    template <size_t N>
+    static void log(Level lvl, const FormatBuffer<N>& msg) {
+        log(lvl, msg.data(), msg.size());
+    }
+
+    /**
+     * @brief Log a message on behalf of a rate-limited call site.
+     * @param lvl Severity level of the message.
+     * @param msg The message to log.
+     * @param suppressed Records suppressed at that call site since the
+     *        previous one; appended to the message when non-zero.
+     */
+    static void log_limited(Level lvl, const std::string& msg, uint64_t suppressed);
+
+    /**
+     * @brief Write a "suppressed K similar messages" record for each
+     *        rate-limited call site that went quiet with a pending count.
+     *        Called on every logged record once such a window has ended;
+     *        call it with `all` before shutdown so no count is lost.
+     * @param all Also report sites whose window is still open.
+     */
+    static void flush_suppressed(bool all = false);
+
     /******************************************************************/
 
     /* Private Methods */
 
    private:
+    /**
+     * @struct SinkEntry
+     * @brief A registered sink and its level threshold.
+     */
+    struct SinkEntry {
+        std::shared_ptr<ILogSink> sink;
+        Level level;
+    };
+
+    /**
+     * @brief Immutable snapshot of the registered sinks.
+     */
+    using SinkList = std::vector<SinkEntry>;
+
+    /**
+     * @brief Publish a new sink list and refresh the cached thresholds (mtx must be held).
+     * @param list The new list.
+     */
+    static void publish(std::shared_ptr<const SinkList> list);
+
     /**
      * @brief Get the current timestamp as a string.
-     * @return A formatted timestamp ("YYYY-MM-DD HH:MM:SS").
+     * @return A formatted timestamp ("YYYY-MM-DD HH:MM:SS"), cached per thread.
      */
-    static std::string timestamp();
+    static const std::string& timestamp();
+
+    /**
+     * @brief Build the complete output line of a record.
+     * @param lvl Severity level of the record.
+     * @param msg The message.
+     * @param len Length of the message.
+     * @return "[timestamp] [LEVEL] msg\n", in a per-thread buffer reused by
+     *         the next call.
+     */
+    static const std::string& format(Level lvl, const char* msg, size_t len);
 
     /**
      * @brief Convert a log level to its string representation.
@@ -115,13 +272,103 @@ class Logger {
      */
     static const char* levelToString(Level);
 
+    /**
+     * @brief Log the pending count of a rate-limited call site.
+     * @param lvl Level of the site's records.
+     * @param site Call site ("file:line").
+     * @param suppressed Records suppressed at that site.
+     */
+    static void report_suppressed(Level lvl, const char* site, uint64_t suppressed);
+
     /******************************************************************/
 
     /* Private Attributes */
 
    private:
-    static std::mutex mtx; /**< Mutex for synchronizing log output. */
+    static std::mutex mtx; /**< Mutex for synchronizing configuration changes. */
     static Level minLevel; /**< Minimum level required to print messages. */
+    static std::shared_ptr<const SinkList> sinks; /**< Registered sinks (copy-on-write). */
+    static std::atomic<int> deliverThreshold; /**< Lowest level accepted by any sink. */
+    static std::atomic<int> captureLevel; /**< Lowest level sent to the FlightRecorder. */
+    static std::atomic<int> threshold; /**< Lowest level accepted by any destination. */
 
     /******************************************************************/
-};
\ No newline at end of file
+};
+
+/*****************************************************************************/
+
+/* Call-site macros */
+
+/**
+ * @brief Log `expr` at `lvl`, evaluating `expr` only if the level is enabled.
+ */
+#define LOGGER_LOG(lvl, expr)           \
+    do {                                \
+        if (Logger::enabled(lvl)) {     \
+            Logger::log((lvl), (expr)); \
+        }                               \
+    } while (0)
+
+/**
+ * @brief Expansion of a stripped level: `expr` is still type-checked
+ *        but never evaluated, and no code is emitted, even at -O0.
+ */
+#define LOGGER_STRIPPED(expr) \
+    do {                      \
+        (void)sizeof((expr)); \
+    } while (0)
+
+/**
+ * @brief "file:line" of the expansion, as a string literal.
+ */
+#define LOGGER_STRINGIFY_IMPL(x) #x
+#define LOGGER_STRINGIFY(x) LOGGER_STRINGIFY_IMPL(x)
+#define LOGGER_SITE __FILE__ ":" LOGGER_STRINGIFY(__LINE__)
+
+/**
+ * @brief Log `expr` at `lvl`, at most `max_n` times per `interval` for this
+ *        call site. Rejected records cost two atomic operations.
+ */
+#define LOGGER_LOG_LIMITED(lvl, max_n, interval, expr)                                    \
+    do {                                                                                  \
+        if (Logger::enabled(lvl)) {                                                       \
+            static LogRateLimiter logger_site_limiter(                                    \
+                (max_n), std::chrono::duration_cast<std::chrono::milliseconds>(interval), \
+                (lvl), LOGGER_SITE);                                                      \
+            uint64_t logger_site_suppressed = 0;                                          \
+            if (logger_site_limiter.allow(logger_site_suppressed)) {                      \
+                Logger::log_limited((lvl), (expr), logger_site_suppressed);               \
+            }                                                                             \
+        }                                                                                 \
+    } while (0)
+
+#if LOGGER_COMPILE_MIN_LEVEL <= 0
+#define LOG_DEBUG(expr) LOGGER_LOG(Logger::Level::DBG, expr)
+#define LOG_DEBUG_LIMITED(max_n, interval, expr) \
+    LOGGER_LOG_LIMITED(Logger::Level::DBG, max_n, interval, expr)
+#else
+#define LOG_DEBUG(expr) LOGGER_STRIPPED(expr)
+#define LOG_DEBUG_LIMITED(max_n, interval, expr) LOGGER_STRIPPED(expr)
+#endif
+
+#if LOGGER_COMPILE_MIN_LEVEL <= 1
+#define LOG_INFO(expr) LOGGER_LOG(Logger::Level::INFO, expr)
+#define LOG_INFO_LIMITED(max_n, interval, expr) \
+    LOGGER_LOG_LIMITED(Logger::Level::INFO, max_n, interval, expr)
+#else
+#define LOG_INFO(expr) LOGGER_STRIPPED(expr)
+#define LOG_INFO_LIMITED(max_n, interval, expr) LOGGER_STRIPPED(expr)
+#endif
+
+#if LOGGER_COMPILE_MIN_LEVEL <= 2
+#define LOG_WARN(expr) LOGGER_LOG(Logger::Level::WARN, expr)
+#define LOG_WARN_LIMITED(max_n, interval, expr) \
+    LOGGER_LOG_LIMITED(Logger::Level::WARN, max_n, interval, expr)
+#else
+#define LOG_WARN(expr) LOGGER_STRIPPED(expr)
+#define LOG_WARN_LIMITED(max_n, interval, expr) LOGGER_STRIPPED(expr)
+#endif
+
+#define LOG_ERROR(expr) LOGGER_LOG(Logger::Level::ERROR, expr)
+#define LOG_ERROR_LIMITED(max_n, interval, expr) \
+    LOGGER_LOG_LIMITED(Logger::Level::ERROR, max_n, interval, expr)
@@ -0,0 +1,88 @@
+/**
+ * @file        memory_sink.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Log sink keeping the most recent records in memory.
+ *
+ * @details
+ * `MemorySink` stores the last N records in a ring. It is useful to
+ * expose recent activity (e.g. on a diagnostics endpoint) and to inspect
+ * log output in tests.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class MemorySink
+ * @brief Fixed-capacity ring of the most recent records.
+ */
+class MemorySink : public ILogSink {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the MemorySink class.
+     * @param capacity Number of records retained, by default 1024.
+     */
+    explicit MemorySink(size_t capacity = 1024);
+
+    /**
+     * @brief Store the record, overwriting the oldest one when full.
+     * @param record The formatted record.
+     */
+    void write(const LogRecord& record) override;
+
+    /**
+     * @brief Copy of the retained records, oldest first.
+     */
+    std::vector<std::string> snapshot() const;
+
+    /**
+     * @brief Discard every retained record.
+     */
+    void clear();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Protects the ring.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Ring storage.
+     */
+    std::vector<std::string> ring;
+
+    /**
+     * @brief Total number of records written (next slot is next % capacity).
+     */
+    size_t next;
+
+    /******************************************************************/
+};
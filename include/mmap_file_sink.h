@@ -0,0 +1,265 @@
+/**
+ * @file        mmap_file_sink.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free log sink writing into a memory-mapped file.
+ *
+ * @details
+ * `MmapFileSink` maps a pre-sized region of the log file and lets every
+ * logging thread reserve space in it with a single atomic fetch-add on a
+ * shared cursor, then copy its record in place. There is no lock and no
+ * system call on the write path.
+ *
+ * When the region is full, the thread whose reservation crossed the end
+ * maps the next region: either further into the same file (EXTEND) or in a
+ * fresh file after rotating the current one to `path.1` (ROTATE). A
+ * background thread periodically issues `msync(MS_ASYNC)` on the active
+ * region and retires full regions once no writer is using them.
+ *
+ * Retiring a region trims the unused tail: in ROTATE mode the file is
+ * truncated; in EXTEND mode the tail is padded with spaces and a newline,
+ * since the next region already follows it in the file.
+ *
+ * Only available on POSIX systems.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+#if !defined(_WIN32)
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "log_sink.h"
+
+/*****************************************************************************/
+
+/**
+ * @class MmapFileSink
+ * @brief Memory-mapped file destination with an atomic write cursor.
+ */
+class MmapFileSink : public ILogSink {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @enum FullPolicy
+     * @brief What to do when the mapped region is full.
+     */
+    enum class FullPolicy {
+        EXTEND, /**< Grow the file and map the next region of it. */
+        ROTATE  /**< Rotate the file to path.1 and map a fresh one. */
+    };
+
+    /**
+     * @struct Options
+     * @brief Configuration of a MmapFileSink.
+     */
+    struct Options {
+        /** Path of the active log file. */
+        std::string path;
+
+        /** Size of each mapped region (rounded up to the page size). */
+        size_t region_size = 16u << 20;
+
+        /** Behavior when the region is full. */
+        FullPolicy when_full = FullPolicy::ROTATE;
+
+        /** Number of rotated files kept besides the active one (ROTATE only). */
+        size_t max_files = 5;
+
+        /** Period of the background msync(MS_ASYNC). */
+        std::chrono::milliseconds sync_interval{500};
+    };
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Open (or create) the file, map the first region and start the sync thread.
+     *        Records are appended after any existing content.
+     * @param options Sink configuration.
+     * @throw std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MmapFileSink(const Options& options);
+
+    /**
+     * @brief Stop the sync thread, sync and unmap every region and trim the file.
+     *        No thread may be writing to the sink any more.
+     */
+    ~MmapFileSink() override;
+
+    /**
+     * @brief Disable copy constructor.
+     *        A MmapFileSink owns mappings, descriptors and a thread.
+     */
+    MmapFileSink(const MmapFileSink&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    MmapFileSink& operator=(const MmapFileSink&) = delete;
+
+    /**
+     * @brief Append a formatted record.
+     * @param record The record delivered by the Logger.
+     */
+    void write(const LogRecord& record) override;
+
+    /**
+     * @brief Append raw bytes. Records larger than a region are dropped.
+     * @param data Bytes to append.
+     * @param len Number of bytes.
+     */
+    void write(const char* data, size_t len);
+
+    /**
+     * @brief Synchronously msync the active region.
+     */
+    void flush();
+
+    /**
+     * @brief Number of times a full region was replaced.
+     */
+    uint64_t rollovers() const;
+
+    /**
+     * @brief Number of bytes dropped (records larger than a region).
+     */
+    uint64_t bytes_dropped() const;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+   private:
+    /**
+     * @struct Segment
+     * @brief One mapped region of a file.
+     */
+    struct Segment {
+        int fd;                        /**< Descriptor of the mapped file. */
+        bool owns_fd;                  /**< Close fd when the segment is retired. */
+        char* base;                    /**< Start of the mapping. */
+        size_t size;                   /**< Length of the mapping. */
+        uint64_t file_offset;          /**< File offset of base. */
+        std::atomic<size_t> cursor;    /**< Next free byte (may run past size). */
+        std::atomic<int> writers;      /**< Threads currently using the segment. */
+        std::atomic<size_t> valid_end; /**< End of data, set by the overflowing writer. */
+        bool finalized;                /**< Unmapped and trimmed. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Map a region of fd at file_offset, growing the file as needed.
+     * @param start Initial cursor within the region.
+     */
+    Segment* map_segment(int fd, bool owns_fd, uint64_t file_offset, size_t start);
+
+    /**
+     * @brief Replace the full segment `seg` with the next one, unless another
+     *        thread already did.
+     * @return false if the next segment could not be mapped.
+     */
+    bool roll(Segment* seg);
+
+    /**
+     * @brief Shift rotated files and open a fresh active file.
+     * @return The new descriptor.
+     */
+    int rotate_files();
+
+    /**
+     * @brief Sync, unmap and trim a segment no thread uses any more (mtx held).
+     * @param last true for the active segment at destruction.
+     */
+    void finalize(Segment* seg, bool last);
+
+    /**
+     * @brief Background sync/retire loop.
+     */
+    void run();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Sink configuration (region_size rounded to the page size).
+     */
+    Options options;
+
+    /**
+     * @brief Segment receiving writes.
+     */
+    std::atomic<Segment*> current;
+
+    /**
+     * @brief Serializes roll() and protects the segment lists.
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Wakes the background thread.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Full segments waiting for their writers to finish.
+     */
+    std::vector<Segment*> retired;
+
+    /**
+     * @brief Every segment ever created. Segments stay allocated until the
+     *        sink is destroyed, so late writers can safely observe them.
+     */
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    /**
+     * @brief Set when the background thread must exit.
+     */
+    bool stopping;
+
+    /**
+     * @brief Statistics.
+     */
+    std::atomic<uint64_t> rollover_count;
+    std::atomic<uint64_t> dropped_total;
+
+    /**
+     * @brief Background sync thread.
+     */
+    std::thread syncer;
+
+    /******************************************************************/
+};
+
+#endif  // !defined(_WIN32)
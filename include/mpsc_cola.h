@@ -0,0 +1,119 @@
+/**
+ * @file        mpsc_cola.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Blocking single-consumer queue of intrusive nodes.
+ *
+ * @details
+ * `MpscCola<T>` wraps an `IntrusiveMpscQueue<T>` with an `EventCount`, so
+ * a single consumer can block in `pop(timeout)` like with `Cola<T*>`:
+ * - `push` never allocates and never locks: it links the node and skips
+ *   the wake-up system call while the consumer is busy.
+ * - It is unbounded; nothing is ever discarded.
+ * - Only one thread may consume (`pop` / `try_pop`), e.g. one
+ *   `Worker<T*, MpscCola<T>>`.
+ *
+ * The queue never owns the nodes; the consumer takes over each popped node.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "event_count.h"
+#include "intrusive_mpsc_queue.h"
+
+/*****************************************************************************/
+
+/**
+ * @class MpscCola
+ * @brief Unbounded MPSC queue of nodes with a blocking pop.
+ * @tparam T Element type, deriving from MpscNode.
+ */
+template <typename T>
+class MpscCola {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the MpscCola class.
+     */
+    MpscCola() = default;
+
+    /**
+     * @brief Destructor of the MpscCola class. Nodes still queued are not touched.
+     */
+    ~MpscCola() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        The queue owns synchronization primitives, which are non-copyable.
+     */
+    MpscCola(const MpscCola&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    MpscCola& operator=(const MpscCola&) = delete;
+
+    /**
+     * @brief Append a node and wake the consumer if it is waiting.
+     * @param node Node to append; must not be queued already.
+     */
+    void push(T* node);
+
+    /**
+     * @brief Removes the oldest node, waiting up to a timeout. Single consumer only.
+     * @param timeout Maximum time to wait for data.
+     * @return The node, or `nonstd::nullopt` if the timeout expires without data.
+     */
+    nonstd::optional<T*> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Removes the oldest node without waiting. Single consumer only.
+     * @return The node, or nullptr if none is available.
+     */
+    T* try_pop();
+
+    /**
+     * @brief Whether no node is available. Single consumer only.
+     */
+    bool is_empty(void) const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Lock-free storage.
+     */
+    IntrusiveMpscQueue<T> queue;
+
+    /**
+     * @brief Signalled after each push; the consumer waits on it.
+     */
+    EventCount not_empty;
+
+    /******************************************************************/
+};
+
+#include "mpsc_cola.ipp"
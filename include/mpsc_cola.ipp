@@ -0,0 +1,59 @@
+/**
+ * @file        mpsc_cola.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class MpscCola<T>.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "mpsc_cola.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+void MpscCola<T>::push(T* node) {
+    queue.push(node);
+    not_empty.notify();
+}
+
+/**
+ * @details try_pop() may miss a node whose push is half-way through; that
+ *          producer notifies once it has linked the node, which ends the
+ *          wait.
+ */
+template <typename T>
+nonstd::optional<T*> MpscCola<T>::pop(std::chrono::seconds timeout) {
+    const std::chrono::steady_clock::time_point until = std::chrono::steady_clock::now() + timeout;
+    T* node = queue.try_pop();
+    while (node == nullptr) {
+        const EventCount::Key key = not_empty.prepare_wait();
+        node = queue.try_pop();
+        if (node != nullptr) {
+            not_empty.cancel_wait();
+            break;
+        }
+        if (!not_empty.commit_wait(key, until)) {
+            return nonstd::nullopt;
+        }
+    }
+    return node;
+}
+
+template <typename T>
+T* MpscCola<T>::try_pop() {
+    return queue.try_pop();
+}
+
+template <typename T>
+bool MpscCola<T>::is_empty(void) const {
+    return queue.is_empty();
+}
+
+/*****************************************************************************/
@@ -11,13 +11,18 @@
  * interface. It uses the Logger utility to print information about the
  * Worker lifecycle and its interaction with the queue:
  *
- * - Logs retrieved data values with INFO level.
- * - Logs timeout events (empty queue) with WARN level.
+ * - Logs retrieved data values with INFO level. The message is built in
+ *   a stack buffer with `format_value`, so any T is supported (see
+ *   ValueFormatter) and no allocation takes place.
+ * - Logs timeout events (empty queue) with WARN level, rate-limited
+ *   across all workers sharing the action type.
  * - Logs shutdown events with ERROR level.
  * - Logs when a Worker finishes execution with INFO level.
  *
  * It is intended as the default strategy for observing the behavior
- * of Workers in this project.
+ * of Workers in this project. Messages are only built when their level
+ * is enabled, and disappear entirely from builds whose
+ * `LOG_COMPILE_MIN_LEVEL` is above it.
  */
 
 /*****************************************************************************/
@@ -31,12 +36,15 @@
 /* Standard libraries */
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 /* Project libraries */
 
 #include "i_worker_action.h"
 #include "logger.h"
+#include "value_format.h"
 
 /*****************************************************************************/
 
@@ -52,6 +60,26 @@ template <typename T>
 class PrintWorkerAction : public IWorkerAction<T> {
     /******************************************************************/
 
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Empty-queue warnings allowed per EMPTY_WARN_INTERVAL.
+     */
+    static constexpr uint32_t EMPTY_WARN_BURST = 1;
+
+    /**
+     * @brief Window of the empty-queue warning rate limit.
+     */
+    static constexpr std::chrono::seconds EMPTY_WARN_INTERVAL{5};
+
+    /**
+     * @brief Capacity of the "data processed" message; longer ones are truncated.
+     */
+    static constexpr size_t MESSAGE_CAPACITY = 256;
+
+    /******************************************************************/
+
     /* Public Methods */
 
    public:
@@ -60,25 +88,35 @@ class PrintWorkerAction : public IWorkerAction<T> {
      *          retrieved from the buffer and shows the "dato".
      */
     void trabajo(const std::string& workerName, const T& dato) override {
-        Logger::info("[" + workerName + "] Data processed: " + std::to_string(dato));
+        FormatBuffer<MESSAGE_CAPACITY> msg;
+        LOG_INFO(msg.append("[").append(workerName).append("] Data processed: ").append(dato));
     }
 
     /**
      * @details Prints a message indicating that the timeout retrieving
      *          the "dato" from the buffer has passed and currently it is empty.
+     *          Every idle worker reports once per timeout, so the warning is
+     *          rate-limited and the number of suppressed ones is reported.
      */
     void colaVacia(const std::string& workerName,
                    const std::chrono::seconds waitting_time) override {
-        Logger::warn("[" + workerName + "] Cola empty after timeout of " +
-                     std::to_string(waitting_time.count()) + "s");
+        LOG_WARN_LIMITED(EMPTY_WARN_BURST, EMPTY_WARN_INTERVAL,
+                         "[" + workerName + "] Cola empty after timeout of " +
+                             std::to_string(waitting_time.count()) + "s");
     }
 
     /**
      * @details Prints a message indicating that the worker finished its action.
      */
     void onStop(const std::string& workerName) override {
-        Logger::info("[" + workerName + "] Finished.");
+        LOG_INFO("[" + workerName + "] Finished.");
     }
 
     /******************************************************************/
-};
\ No newline at end of file
+};
+
+// Definitions required for odr-used static constexpr data members (C++14)
+template <typename T>
+constexpr uint32_t PrintWorkerAction<T>::EMPTY_WARN_BURST;
+template <typename T>
+constexpr std::chrono::seconds PrintWorkerAction<T>::EMPTY_WARN_INTERVAL;
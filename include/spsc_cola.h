@@ -0,0 +1,214 @@
+/**
+ * @file        spsc_cola.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free bounded single-producer single-consumer ring queue.
+ *
+ * @details
+ * `SpscCola<T>` connects exactly one producer thread with one consumer
+ * thread through a fixed ring of slots:
+ * - No lock: each side owns one index and only reads the other's; each
+ *   keeps a cached copy of the other index to avoid touching its cache
+ *   line on every call.
+ * - `consume(fn, timeout)` runs `fn` on the element in its slot and only
+ *   then releases the slot, so the element is never moved out of the
+ *   queue. This is safe because only the consumer releases slots and the
+ *   producer never overwrites a slot that has not been released.
+ * - When the ring is full, `push` rejects the new element and returns
+ *   false (the producer cannot evict without racing the consumer).
+ * - The consumer blocks on an `EventCount`; the producer skips the
+ *   wake-up system call while the consumer is busy.
+ *
+ * It exposes the same `pop(timeout)` as `Cola<T>` and can be consumed by
+ * a `Worker<T, SpscCola<T>>`, which uses `consume` to process elements in
+ * place.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/* Project libraries */
+
+#include "event_count.h"
+
+/*****************************************************************************/
+
+/**
+ * @class SpscCola
+ * @brief Bounded lock-free ring queue for one producer and one consumer.
+ * @tparam T Type of elements stored in the queue.
+ */
+template <typename T>
+class SpscCola {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the SpscCola class.
+     * @param max_size Maximum number of elements, by default 5.
+     */
+    explicit SpscCola(size_t max_size = 5);
+
+    /**
+     * @brief Destructor of the SpscCola class. Destroys the elements left.
+     */
+    ~SpscCola();
+
+    /**
+     * @brief Disable copy constructor.
+     *        The queue owns synchronization primitives, which are non-copyable.
+     */
+    SpscCola(const SpscCola&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    SpscCola& operator=(const SpscCola&) = delete;
+
+    /**
+     * @brief Append an element. Producer thread only.
+     * @param dato Data to insert.
+     * @return false if the queue is full (the element is dropped).
+     */
+    bool push(T dato);
+
+    /**
+     * @brief Removes the oldest element, waiting up to a timeout. Consumer thread only.
+     * @param timeout Maximum time to wait for data.
+     * @return The element, or `nonstd::nullopt` if the timeout expires without data.
+     */
+    nonstd::optional<T> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Runs fn on the oldest element in place, then removes it,
+     *        waiting up to a timeout for data. Consumer thread only.
+     * @param fn Callable taking `T&`; the slot stays reserved while it runs.
+     * @param timeout Maximum time to wait for data.
+     * @return false if the timeout expires without data (fn is not called).
+     */
+    template <typename Fn>
+    bool consume(Fn&& fn, std::chrono::seconds timeout);
+
+    /**
+     * @brief Getter of the number of queued elements (approximate under concurrency).
+     */
+    size_t get_size(void) const;
+
+    /**
+     * @brief Indicates if the queue is empty (approximate under concurrency).
+     */
+    bool is_empty(void) const;
+
+    /******************************************************************/
+
+    /* Private Constants */
+
+   private:
+    /**
+     * @brief Assumed cache line size, separating the producer and consumer indices.
+     */
+    static constexpr size_t CACHE_LINE = 64;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+    /**
+     * @brief Uninitialized memory for one element.
+     */
+    using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Address of the slot of a (monotonic) index.
+     */
+    T* slot(size_t index);
+
+    /**
+     * @brief Wait until an element is readable or the deadline passes (consumer).
+     * @return false on timeout.
+     */
+    bool wait_readable(std::chrono::seconds timeout);
+
+    /**
+     * @brief Whether an element is readable, refreshing the cached write index (consumer).
+     */
+    bool readable();
+
+    /**
+     * @brief Destroy the oldest element and release its slot (consumer).
+     */
+    void release();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+    /**
+     * @brief Ring memory, a power of two number of slots.
+     */
+    std::unique_ptr<Slot[]> slots;
+
+    /**
+     * @brief Number of slots minus one.
+     */
+    size_t mask;
+
+    /**
+     * @brief Maximum number of elements.
+     */
+    size_t max_size;
+
+    /**
+     * @brief Next index to write; written by the producer only.
+     */
+    alignas(CACHE_LINE) std::atomic<size_t> write_index;
+
+    /**
+     * @brief Producer's last seen read_index.
+     */
+    size_t cached_read;
+
+    /**
+     * @brief Next index to read; written by the consumer only.
+     */
+    alignas(CACHE_LINE) std::atomic<size_t> read_index;
+
+    /**
+     * @brief Consumer's last seen write_index.
+     */
+    size_t cached_write;
+
+    /**
+     * @brief Signalled after each push; the consumer waits on it.
+     */
+    alignas(CACHE_LINE) EventCount not_empty;
+
+    /******************************************************************/
+};
+
+#include "spsc_cola.ipp"
@@ -0,0 +1,151 @@
+/**
+ * @file        spsc_cola.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class SpscCola<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <new>
+#include <utility>
+
+/* Project libraries */
+
+#include "spsc_cola.h"
+
+// Definition required for odr-used static constexpr data members (C++14)
+template <typename T>
+constexpr size_t SpscCola<T>::CACHE_LINE;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T>
+SpscCola<T>::SpscCola(size_t max_size)
+    : mask(0), max_size(max_size), write_index(0), cached_read(0), read_index(0), cached_write(0) {
+    size_t capacity = 1;
+    while (capacity < max_size) {
+        capacity *= 2;
+    }
+    slots.reset(new Slot[capacity]);
+    mask = capacity - 1;
+}
+
+template <typename T>
+SpscCola<T>::~SpscCola() {
+    while (readable()) {
+        release();
+    }
+}
+
+/**
+ * @details The element is constructed before write_index is published
+ *          with release ordering, so the consumer sees it complete.
+ */
+template <typename T>
+bool SpscCola<T>::push(T dato) {
+    const size_t write = write_index.load(std::memory_order_relaxed);
+    if (write - cached_read >= max_size) {
+        cached_read = read_index.load(std::memory_order_acquire);
+        if (write - cached_read >= max_size) {
+            return false;
+        }
+    }
+    ::new (static_cast<void*>(slot(write))) T(std::move(dato));
+    write_index.store(write + 1, std::memory_order_release);
+    not_empty.notify();
+    return true;
+}
+
+template <typename T>
+nonstd::optional<T> SpscCola<T>::pop(std::chrono::seconds timeout) {
+    if (!wait_readable(timeout)) {
+        return nonstd::nullopt;
+    }
+    nonstd::optional<T> out(std::move(*slot(read_index.load(std::memory_order_relaxed))));
+    release();
+    return out;
+}
+
+/**
+ * @details The slot is released only after fn returns, so the producer
+ *          cannot reuse it while fn is still reading the element.
+ */
+template <typename T>
+template <typename Fn>
+bool SpscCola<T>::consume(Fn&& fn, std::chrono::seconds timeout) {
+    if (!wait_readable(timeout)) {
+        return false;
+    }
+    fn(*slot(read_index.load(std::memory_order_relaxed)));
+    release();
+    return true;
+}
+
+template <typename T>
+size_t SpscCola<T>::get_size(void) const {
+    const size_t read = read_index.load(std::memory_order_relaxed);
+    const size_t write = write_index.load(std::memory_order_relaxed);
+    return write >= read ? write - read : 0;
+}
+
+template <typename T>
+bool SpscCola<T>::is_empty(void) const {
+    return get_size() == 0;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T>
+T* SpscCola<T>::slot(size_t index) {
+    return reinterpret_cast<T*>(&slots[index & mask]);
+}
+
+template <typename T>
+bool SpscCola<T>::wait_readable(std::chrono::seconds timeout) {
+    if (readable()) {
+        return true;
+    }
+    const std::chrono::steady_clock::time_point until = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        const EventCount::Key key = not_empty.prepare_wait();
+        if (readable()) {
+            not_empty.cancel_wait();
+            return true;
+        }
+        if (!not_empty.commit_wait(key, until)) {
+            return false;
+        }
+    }
+}
+
+template <typename T>
+bool SpscCola<T>::readable() {
+    const size_t read = read_index.load(std::memory_order_relaxed);
+    if (read != cached_write) {
+        return true;
+    }
+    cached_write = write_index.load(std::memory_order_acquire);
+    return read != cached_write;
+}
+
+/**
+ * @details The element is destroyed before read_index is published with
+ *          release ordering, so the producer only reuses a dead slot.
+ */
+template <typename T>
+void SpscCola<T>::release() {
+    const size_t read = read_index.load(std::memory_order_relaxed);
+    slot(read)->~T();
+    read_index.store(read + 1, std::memory_order_release);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,216 @@
+/**
+ * @file        stop_token.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Cooperative cancellation flag with stop callbacks.
+ *
+ * @details
+ * A `StopSource` is owned by whoever may cancel some work (e.g. a Worker)
+ * and hands out `StopToken`s, by value, to the code doing it (e.g. an
+ * action). Only the source can request or reset the stop:
+ * - `StopToken::stop_requested()` is one atomic load, cheap enough to poll
+ *   inside a long loop, between chunks of I/O, etc.
+ * - `StopToken::add_callback()` registers a function run once when the
+ *   stop is requested, to interrupt what polling cannot (close a socket,
+ *   cancel a timer). A callback added after the request runs at once.
+ *
+ * A token is a pointer to its source and must not outlive it.
+ * Callbacks run on the thread calling `request_stop()`, outside the
+ * source's lock, so they may add or remove callbacks themselves.
+ * `remove_callback()` does not wait for a callback that is already
+ * running; its captures must stay valid until `request_stop()` returns.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/*****************************************************************************/
+
+class StopToken;
+
+/**
+ * @class StopSource
+ * @brief Owner side: atomic stop flag with the registered callbacks.
+ */
+class StopSource {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    /**
+     * @brief Function run when the stop is requested.
+     */
+    using Callback = std::function<void()>;
+
+    /**
+     * @brief Identifies a registered callback; 0 is never a valid id.
+     */
+    using CallbackId = uint64_t;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the StopSource class. No stop is requested.
+     */
+    StopSource();
+
+    /**
+     * @brief Disable copy constructor.
+     *        Its tokens point to this instance.
+     */
+    StopSource(const StopSource&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    StopSource& operator=(const StopSource&) = delete;
+
+    /**
+     * @brief Whether a stop was requested. Wait-free.
+     */
+    bool stop_requested(void) const;
+
+    /**
+     * @brief Request the stop and run the registered callbacks (once).
+     * @return true if this call made the request, false if it was already made.
+     */
+    bool request_stop();
+
+    /**
+     * @brief Clear the request so the source can be reused.
+     *        Callbacks already run are not registered again.
+     */
+    void reset();
+
+    /**
+     * @brief Get a token observing this source.
+     */
+    StopToken get_token();
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    friend class StopToken;
+
+    /**
+     * @brief See StopToken::add_callback().
+     */
+    CallbackId add_callback(Callback callback);
+
+    /**
+     * @brief See StopToken::remove_callback().
+     */
+    void remove_callback(CallbackId id);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Stop flag.
+     */
+    std::atomic<bool> requested;
+
+    /**
+     * @brief Protects callbacks and next_id.
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Callbacks waiting for the stop request.
+     */
+    std::vector<std::pair<CallbackId, Callback>> callbacks;
+
+    /**
+     * @brief Id of the next registered callback.
+     */
+    CallbackId next_id;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class StopToken
+ * @brief Lent side: observes a StopSource and registers callbacks on it.
+ */
+class StopToken {
+    /******************************************************************/
+
+    /* Public Data Types */
+
+   public:
+    using Callback = StopSource::Callback;
+    using CallbackId = StopSource::CallbackId;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Whether the stop was requested on the source. Wait-free.
+     */
+    bool stop_requested(void) const;
+
+    /**
+     * @brief Register a function to run when the stop is requested.
+     *        Runs it at once, on this thread, if the stop was already requested.
+     * @param callback Function to run.
+     * @return Id for remove_callback(), or 0 if the callback already ran.
+     */
+    CallbackId add_callback(Callback callback);
+
+    /**
+     * @brief Unregister a callback that has not run yet. Unknown ids are ignored.
+     */
+    void remove_callback(CallbackId id);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    friend class StopSource;
+
+    /**
+     * @brief Constructor of the StopToken class, used by StopSource::get_token().
+     */
+    explicit StopToken(StopSource& source);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Observed source.
+     */
+    StopSource* source;
+
+    /******************************************************************/
+};
@@ -0,0 +1,234 @@
+/**
+ * @file        tenant_cola.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Thread-safe multi-tenant queue with weighted fair dequeuing.
+ *
+ * @details
+ * `TenantCola<T>` multiplexes several tenants through one queue without
+ * letting a noisy tenant starve or evict the others:
+ * - Each tenant has its own bounded sub-queue. When it is full, the
+ *   tenant's own oldest element is discarded, never another tenant's.
+ * - `pop` serves the tenants with pending work by deficit round robin:
+ *   on its turn a tenant receives a quantum equal to its weight, and each
+ *   element served costs one unit, so a tenant of weight 3 gets three
+ *   elements for every one of a tenant of weight 1 while both are busy.
+ *   Idle tenants do not accumulate credit.
+ * - Per-tenant depth, push, pop and drop counters are available through
+ *   `get_tenant_stats` / `get_stats`.
+ *
+ * It exposes the same `pop(timeout)` as `Cola<T>` and can be consumed by
+ * a `Worker<T, TenantCola<T>>`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* Third party libraries */
+
+#include "third_party/optional.hpp"
+
+/*****************************************************************************/
+
+/**
+ * @struct TenantStats
+ * @brief Snapshot of the configuration and counters of one tenant.
+ */
+struct TenantStats {
+    size_t depth = 0;     /**< Elements currently queued. */
+    size_t capacity = 0;  /**< Maximum elements queued. */
+    uint32_t weight = 0;  /**< Elements served per round. */
+    uint64_t pushed = 0;  /**< Elements accepted by push(). */
+    uint64_t popped = 0;  /**< Elements returned by pop(). */
+    uint64_t dropped = 0; /**< Oldest elements dropped on a full push(). */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TenantCola
+ * @brief Thread-safe queue of per-tenant sub-queues served by deficit round robin.
+ * @tparam T Type of elements stored in the queue.
+ * @tparam TenantId Tenant identifier (hashable, copyable).
+ */
+template <typename T, typename TenantId = std::string>
+class TenantCola {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructor of the TenantCola class.
+     * @param default_capacity Capacity of tenants created implicitly by push().
+     * @param default_weight Weight of tenants created implicitly by push().
+     */
+    explicit TenantCola(size_t default_capacity = 5, uint32_t default_weight = 1);
+
+    /**
+     * @brief Destructor of the TenantCola class.
+     */
+    ~TenantCola() = default;
+
+    /**
+     * @brief Disable copy constructor.
+     *        The queue owns synchronization primitives, which are non-copyable.
+     */
+    TenantCola(const TenantCola&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TenantCola& operator=(const TenantCola&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     *        Moving would transfer synchronization primitives between instances.
+     */
+    TenantCola(TenantCola&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    TenantCola& operator=(TenantCola&&) = delete;
+
+    /**
+     * @brief Create or reconfigure a tenant.
+     *        Shrinking the capacity drops the tenant's oldest elements.
+     * @param tenant Tenant identifier.
+     * @param capacity Maximum elements queued for the tenant.
+     * @param weight Elements served per round (at least 1).
+     */
+    void set_tenant(const TenantId& tenant, size_t capacity, uint32_t weight = 1);
+
+    /**
+     * @brief Push an element on behalf of a tenant.
+     *        Unknown tenants are created with the default capacity and weight.
+     *        If the tenant's sub-queue is full, its oldest element is discarded.
+     * @param tenant Tenant identifier.
+     * @param dato Data to insert.
+     */
+    void push(const TenantId& tenant, T dato);
+
+    /**
+     * @brief Removes the next element in deficit round robin order,
+     *        waiting up to a timeout.
+     * @param timeout Maximum time to wait for data.
+     * @return The element, or `nonstd::nullopt` if the timeout expires without data.
+     */
+    nonstd::optional<T> pop(std::chrono::seconds timeout);
+
+    /**
+     * @brief Getter of the total number of queued elements.
+     */
+    size_t get_size(void) const;
+
+    /**
+     * @brief Indicates if no tenant has queued elements.
+     */
+    bool is_empty(void) const;
+
+    /**
+     * @brief Getter of one tenant's counters.
+     * @param tenant Tenant identifier.
+     * @return Its statistics, all zero if the tenant is unknown.
+     */
+    TenantStats get_tenant_stats(const TenantId& tenant) const;
+
+    /**
+     * @brief Getter of every tenant's counters, in creation order.
+     */
+    std::vector<std::pair<TenantId, TenantStats>> get_stats(void) const;
+
+    /******************************************************************/
+
+    /* Private Data Types */
+
+   private:
+    /**
+     * @struct Tenant
+     * @brief Sub-queue and scheduling state of a tenant.
+     */
+    struct Tenant {
+        TenantId id;          /**< Tenant identifier. */
+        std::deque<T> buffer; /**< Pending elements, oldest first. */
+        uint32_t deficit = 0; /**< Elements left in the current turn. */
+        bool active = false;  /**< Present in the round robin list. */
+        TenantStats stats;    /**< Configuration and counters. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+    /**
+     * @brief Find or create a tenant (mtx held).
+     * @return Its index in tenants.
+     */
+    size_t tenant_index(const TenantId& tenant);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Tenants, in creation order. Never removed, so indices are stable.
+     */
+    std::vector<Tenant> tenants;
+
+    /**
+     * @brief Index in tenants of each identifier.
+     */
+    std::unordered_map<TenantId, size_t> index;
+
+    /**
+     * @brief Tenants with pending elements, in round robin order.
+     *        The front one is being served.
+     */
+    std::deque<size_t> active;
+
+    /**
+     * @brief Total number of queued elements.
+     */
+    size_t total;
+
+    /**
+     * @brief Defaults of implicitly created tenants.
+     */
+    size_t default_capacity;
+    uint32_t default_weight;
+
+    /**
+     * @brief Mutex.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Condition variable.
+     */
+    std::condition_variable cv;
+
+    /******************************************************************/
+};
+
+#include "tenant_cola.ipp"
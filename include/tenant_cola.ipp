@@ -0,0 +1,174 @@
+/**
+ * @file        tenant_cola.ipp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Implementation file for the template class TenantCola<T>.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+
+/* Project libraries */
+
+#include "tenant_cola.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <typename T, typename TenantId>
+TenantCola<T, TenantId>::TenantCola(size_t default_capacity, uint32_t default_weight)
+    : total(0),
+      default_capacity(default_capacity),
+      default_weight(std::max<uint32_t>(default_weight, 1)) {}
+
+template <typename T, typename TenantId>
+void TenantCola<T, TenantId>::set_tenant(const TenantId& tenant, size_t capacity,
+                                         uint32_t weight) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Tenant& t = tenants[tenant_index(tenant)];
+    t.stats.capacity = capacity;
+    t.stats.weight = std::max<uint32_t>(weight, 1);
+    t.deficit = std::min(t.deficit, t.stats.weight);
+    while (t.buffer.size() > capacity) {
+        t.buffer.pop_front();
+        ++t.stats.dropped;
+        --total;
+    }
+    // An emptied tenant stays in the active list; pop() skips it
+}
+
+template <typename T, typename TenantId>
+void TenantCola<T, TenantId>::push(const TenantId& tenant, T dato) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        const size_t i = tenant_index(tenant);
+        Tenant& t = tenants[i];
+        if (t.stats.capacity == 0) {
+            ++t.stats.dropped;
+            return;
+        }
+        if (t.buffer.size() >= t.stats.capacity) {
+            t.buffer.pop_front();  // Take out the tenant's eldest "dato"
+            ++t.stats.dropped;
+            --total;
+        }
+        t.buffer.push_back(std::move(dato));
+        ++t.stats.pushed;
+        ++total;
+        if (!t.active) {
+            t.active = true;
+            active.push_back(i);
+        }
+    }
+    cv.notify_one();
+}
+
+/**
+ * @details The front tenant is served until its quantum (weight) is used
+ *          up, then moved to the back of the list; a tenant whose sub-queue
+ *          empties leaves the list and loses its remaining deficit.
+ */
+template <typename T, typename TenantId>
+nonstd::optional<T> TenantCola<T, TenantId>::pop(std::chrono::seconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // Wait until new data is added or until time is out
+    if (!cv.wait_for(lock, timeout, [this] { return total > 0; })) {
+        return nonstd::nullopt;
+    }
+
+    while (true) {
+        const size_t i = active.front();
+        Tenant& t = tenants[i];
+        if (t.buffer.empty()) {
+            t.active = false;
+            t.deficit = 0;
+            active.pop_front();
+            continue;
+        }
+        if (t.deficit == 0) {
+            t.deficit = t.stats.weight;  // New turn
+        }
+
+        T out = std::move(t.buffer.front());
+        t.buffer.pop_front();
+        --t.deficit;
+        --total;
+        ++t.stats.popped;
+
+        if (t.buffer.empty()) {
+            t.active = false;
+            t.deficit = 0;
+            active.pop_front();
+        } else if (t.deficit == 0) {
+            active.pop_front();
+            active.push_back(i);
+        }
+        return out;
+    }
+}
+
+template <typename T, typename TenantId>
+size_t TenantCola<T, TenantId>::get_size(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return total;
+}
+
+template <typename T, typename TenantId>
+bool TenantCola<T, TenantId>::is_empty(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return total == 0;
+}
+
+template <typename T, typename TenantId>
+TenantStats TenantCola<T, TenantId>::get_tenant_stats(const TenantId& tenant) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = index.find(tenant);
+    if (it == index.end()) {
+        return TenantStats();
+    }
+    const Tenant& t = tenants[it->second];
+    TenantStats snapshot = t.stats;
+    snapshot.depth = t.buffer.size();
+    return snapshot;
+}
+
+template <typename T, typename TenantId>
+std::vector<std::pair<TenantId, TenantStats>> TenantCola<T, TenantId>::get_stats(void) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::pair<TenantId, TenantStats>> out;
+    out.reserve(tenants.size());
+    for (const Tenant& t : tenants) {
+        TenantStats snapshot = t.stats;
+        snapshot.depth = t.buffer.size();
+        out.emplace_back(t.id, snapshot);
+    }
+    return out;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+template <typename T, typename TenantId>
+size_t TenantCola<T, TenantId>::tenant_index(const TenantId& tenant) {
+    auto it = index.find(tenant);
+    if (it != index.end()) {
+        return it->second;
+    }
+    Tenant t;
+    t.id = tenant;
+    t.stats.capacity = default_capacity;
+    t.stats.weight = default_weight;
+    tenants.push_back(std::move(t));
+    index.emplace(tenant, tenants.size() - 1);
+    return tenants.size() - 1;
+}
+
+/*****************************************************************************/
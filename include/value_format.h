@@ -0,0 +1,390 @@
+/**
+ * @file        value_format.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Allocation-free formatting of values into caller-provided buffers.
+ *
+ * @details
+ * `format_value(value, buf, cap)` writes a textual representation of any
+ * value into `buf` and returns the number of characters written (never
+ * more than `cap`, output is truncated, not NUL-terminated).
+ *
+ * - Integers use a two-digits-at-a-time conversion with a digit-pair table.
+ * - Floating point values are printed with up to 6 decimals, trailing zeros
+ *   removed; very large or very small magnitudes fall back to "%g".
+ * - Strings and C strings are copied; pairs are printed as "first=second".
+ * - Any other type can be supported by specializing `ValueFormatter<T>`.
+ *   Types without a specialization but with an `operator<<` are formatted
+ *   through an std::ostringstream (this fallback allocates); the rest are
+ *   printed as "<?>".
+ *
+ * `FormatBuffer<N>` chains several values into a fixed stack buffer and can
+ * be passed directly to the Logger.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*****************************************************************************/
+
+/* Integer formatting */
+
+/**
+ * @brief "00" to "99", used to emit two digits per division.
+ */
+constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief Maximum number of characters produced for a 64-bit integer.
+ */
+constexpr size_t MAX_INTEGER_CHARS = 20;
+
+/**
+ * @brief Write the decimal digits of an unsigned integer.
+ * @param value Value to convert.
+ * @param out Buffer of at least MAX_INTEGER_CHARS characters.
+ * @return Number of characters written.
+ */
+inline size_t format_uint(uint64_t value, char* out) {
+    char tmp[MAX_INTEGER_CHARS];
+    char* p = tmp + MAX_INTEGER_CHARS;
+    while (value >= 100) {
+        const size_t pair = static_cast<size_t>(value % 100) * 2;
+        value /= 100;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    }
+    if (value >= 10) {
+        const size_t pair = static_cast<size_t>(value) * 2;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    } else {
+        *--p = static_cast<char>('0' + value);
+    }
+    const size_t len = static_cast<size_t>(tmp + MAX_INTEGER_CHARS - p);
+    std::memcpy(out, p, len);
+    return len;
+}
+
+/**
+ * @brief Write the decimal digits of a signed integer.
+ * @param value Value to convert.
+ * @param out Buffer of at least MAX_INTEGER_CHARS characters.
+ * @return Number of characters written.
+ */
+inline size_t format_int(int64_t value, char* out) {
+    if (value < 0) {
+        *out = '-';
+        // Negate in unsigned arithmetic so INT64_MIN does not overflow
+        return 1 + format_uint(0 - static_cast<uint64_t>(value), out + 1);
+    }
+    return format_uint(static_cast<uint64_t>(value), out);
+}
+
+/*****************************************************************************/
+
+/* Floating point formatting */
+
+/**
+ * @brief Write a floating point value with up to 6 decimals.
+ * @param value Value to convert.
+ * @param out Destination buffer.
+ * @param cap Capacity of out.
+ * @return Number of characters written (at most cap).
+ */
+inline size_t format_double(double value, char* out, size_t cap) {
+    char tmp[64];
+    size_t len = 0;
+    const double magnitude = std::fabs(value);
+
+    if (std::isnan(value)) {
+        std::memcpy(tmp, "nan", 3);
+        len = 3;
+    } else if (std::isinf(value)) {
+        len = value < 0 ? 4 : 3;
+        std::memcpy(tmp, value < 0 ? "-inf" : "inf", len);
+    } else if (magnitude == 0.0) {
+        tmp[0] = '0';
+        len = 1;
+    } else if (magnitude >= 1e15 || magnitude < 1e-4) {
+        const int n = std::snprintf(tmp, sizeof(tmp), "%g", value);
+        len = n > 0 ? static_cast<size_t>(n) : 0;
+    } else {
+        uint64_t integral = static_cast<uint64_t>(magnitude);
+        uint64_t decimals =
+            static_cast<uint64_t>(std::llround((magnitude - static_cast<double>(integral)) * 1e6));
+        if (decimals >= 1000000) {
+            ++integral;
+            decimals -= 1000000;
+        }
+        if (value < 0) {
+            tmp[len++] = '-';
+        }
+        len += format_uint(integral, tmp + len);
+        if (decimals > 0) {
+            tmp[len++] = '.';
+            char digits[6];
+            for (int i = 5; i >= 0; --i) {
+                digits[i] = static_cast<char>('0' + decimals % 10);
+                decimals /= 10;
+            }
+            size_t used = 6;
+            while (digits[used - 1] == '0') {
+                --used;
+            }
+            std::memcpy(tmp + len, digits, used);
+            len += used;
+        }
+    }
+
+    len = len < cap ? len : cap;
+    std::memcpy(out, tmp, len);
+    return len;
+}
+
+/*****************************************************************************/
+
+/* Customization point */
+
+/**
+ * @brief Detects whether `std::ostream << T` is valid.
+ */
+template <typename T, typename = void>
+struct IsStreamable : std::false_type {};
+
+template <typename T>
+struct IsStreamable<
+    T, decltype(void(std::declval<std::ostream&>() << std::declval<const T&>()))>
+    : std::true_type {};
+
+/**
+ * @struct ValueFormatter
+ * @brief Formats values of type T. Specialize it to support new types:
+ *
+ * @code
+ * template <>
+ * struct ValueFormatter<Point> {
+ *     static size_t format(const Point& p, char* buf, size_t cap);
+ * };
+ * @endcode
+ *
+ * The primary template uses `operator<<` when available (allocating),
+ * otherwise it prints "<?>".
+ */
+template <typename T, typename Enable = void>
+struct ValueFormatter {
+    static size_t format(const T& value, char* buf, size_t cap) {
+        return format_fallback(value, buf, cap, IsStreamable<T>());
+    }
+
+   private:
+    static size_t copy(const char* text, size_t len, char* buf, size_t cap) {
+        len = len < cap ? len : cap;
+        std::memcpy(buf, text, len);
+        return len;
+    }
+
+    template <typename U>
+    static size_t format_fallback(const U& value, char* buf, size_t cap, std::true_type) {
+        std::ostringstream oss;
+        oss << value;
+        const std::string text = oss.str();
+        return copy(text.data(), text.size(), buf, cap);
+    }
+
+    template <typename U>
+    static size_t format_fallback(const U&, char* buf, size_t cap, std::false_type) {
+        return copy("<?>", 3, buf, cap);
+    }
+};
+
+/**
+ * @brief Signed and unsigned integers (bool excluded).
+ */
+template <typename T>
+struct ValueFormatter<
+    T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+    static size_t format(T value, char* buf, size_t cap) {
+        char tmp[MAX_INTEGER_CHARS + 1];
+        const size_t len = std::is_signed<T>::value
+                               ? format_int(static_cast<int64_t>(value), tmp)
+                               : format_uint(static_cast<uint64_t>(value), tmp);
+        const size_t n = len < cap ? len : cap;
+        std::memcpy(buf, tmp, n);
+        return n;
+    }
+};
+
+/**
+ * @brief Floating point values.
+ */
+template <typename T>
+struct ValueFormatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static size_t format(T value, char* buf, size_t cap) {
+        return format_double(static_cast<double>(value), buf, cap);
+    }
+};
+
+/**
+ * @brief Booleans, as "true"/"false".
+ */
+template <>
+struct ValueFormatter<bool> {
+    static size_t format(bool value, char* buf, size_t cap) {
+        const size_t len = value ? 4 : 5;
+        const size_t n = len < cap ? len : cap;
+        std::memcpy(buf, value ? "true" : "false", n);
+        return n;
+    }
+};
+
+/**
+ * @brief std::string, copied as is.
+ */
+template <>
+struct ValueFormatter<std::string> {
+    static size_t format(const std::string& value, char* buf, size_t cap) {
+        const size_t n = value.size() < cap ? value.size() : cap;
+        std::memcpy(buf, value.data(), n);
+        return n;
+    }
+};
+
+/**
+ * @brief NUL-terminated C strings.
+ */
+template <>
+struct ValueFormatter<const char*> {
+    static size_t format(const char* value, char* buf, size_t cap) {
+        size_t n = 0;
+        while (n < cap && value[n] != '\0') {
+            buf[n] = value[n];
+            ++n;
+        }
+        return n;
+    }
+};
+
+template <>
+struct ValueFormatter<char*> : ValueFormatter<const char*> {};
+
+/**
+ * @brief Pairs, as "first=second" (e.g. the key/value of a ConflatingCola).
+ */
+template <typename A, typename B>
+struct ValueFormatter<std::pair<A, B>> {
+    static size_t format(const std::pair<A, B>& value, char* buf, size_t cap) {
+        size_t n = ValueFormatter<A>::format(value.first, buf, cap);
+        if (n < cap) {
+            buf[n++] = '=';
+        }
+        return n + ValueFormatter<B>::format(value.second, buf + n, cap - n);
+    }
+};
+
+/**
+ * @brief Format any value into a caller-provided buffer.
+ * @param value Value to format.
+ * @param buf Destination buffer.
+ * @param cap Capacity of buf.
+ * @return Number of characters written (at most cap).
+ */
+template <typename T>
+size_t format_value(const T& value, char* buf, size_t cap) {
+    return ValueFormatter<typename std::decay<T>::type>::format(value, buf, cap);
+}
+
+/*****************************************************************************/
+
+/**
+ * @class FormatBuffer
+ * @brief Fixed-capacity stack buffer that values are appended to.
+ * @tparam N Capacity in characters; longer output is truncated.
+ */
+template <size_t N>
+class FormatBuffer {
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    FormatBuffer() : len(0) {}
+
+    /**
+     * @brief Append a value.
+     * @return *this, to chain appends.
+     */
+    template <typename T>
+    FormatBuffer& append(const T& value) {
+        len += format_value(value, text + len, N - len);
+        return *this;
+    }
+
+    /**
+     * @brief Append a string literal without scanning for its terminator.
+     */
+    template <size_t M>
+    FormatBuffer& append(const char (&literal)[M]) {
+        const size_t n = (M - 1) < (N - len) ? (M - 1) : (N - len);
+        std::memcpy(text + len, literal, n);
+        len += n;
+        return *this;
+    }
+
+    /**
+     * @brief Formatted characters (not NUL-terminated).
+     */
+    const char* data() const { return text; }
+
+    /**
+     * @brief Number of formatted characters.
+     */
+    size_t size() const { return len; }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Storage.
+     */
+    char text[N];
+
+    /**
+     * @brief Characters used.
+     */
+    size_t len;
+
+    /******************************************************************/
+};
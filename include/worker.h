@@ -17,6 +17,19 @@
  * behavior applied to each element, making it possible to plug in
  * different actions (e.g., logging, processing, testing) without
  * modifying the Worker itself.
+ *
+ * The queue type is a template parameter (`Cola<T>` by default), so any
+ * queue exposing `nonstd::optional<T> pop(std::chrono::seconds)` can be
+ * consumed, e.g. `ConflatingCola<K, V>` with `T = std::pair<K, V>`.
+ * Every element is handed to `IWorkerAction::trabajo_cancelable()`
+ * together with the worker's `StopToken`. `stop()` signals it, so a long
+ * action can return early, and `stop(deadline)` waits only up to a
+ * deadline for the element in flight; elements the action reports as not
+ * completed are passed to `IWorkerAction::onAbandoned()`.
+ *
+ * When the queue also provides `bool consume(fn, std::chrono::seconds)`,
+ * the Worker uses it instead, so queues able to hand out elements in place
+ * (e.g. `SpscCola<T>`) save the move into an optional.
  */
 
 /*****************************************************************************/
@@ -30,14 +43,33 @@
 /* Standard libraries */
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <utility>
 
 /* Project libraries */
 
 #include "cola.h"
 #include "i_worker_action.h"
+#include "stop_token.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief Whether Queue provides `bool consume(fn, std::chrono::seconds)` for T.
+ */
+template <typename Queue, typename T, typename = void>
+struct QueueHasConsume : std::false_type {};
+
+template <typename Queue, typename T>
+struct QueueHasConsume<Queue, T,
+                       decltype(void(std::declval<Queue&>().consume(
+                           std::declval<void (*)(T&)>(), std::chrono::seconds())))>
+    : std::true_type {};
 
 /*****************************************************************************/
 
@@ -45,12 +77,13 @@
  * @class Worker
  * @brief Worker thread that consumes data from a queue.
  * @tparam T Type of data consumed from the queue.
+ * @tparam Queue Queue type, providing `nonstd::optional<T> pop(std::chrono::seconds)`.
  *
  * Each Worker runs in its own thread, repeatedly calling `pop()` on the queue
  * and delegating the retrieved data to the associated IWorkerAction.
  * It supports graceful shutdown or immediate stop.
  */
-template <typename T>
+template <typename T, typename Queue = Cola<T>>
 class Worker {
     /******************************************************************/
 
@@ -78,7 +111,7 @@ class Worker {
      * @param action Reference to the action strategy executed by the worker.
      * @param name Optional worker name for logging/identification.
      */
-    explicit Worker(Cola<T>& cola, IWorkerAction<T>& action,
+    explicit Worker(Queue& cola, IWorkerAction<T>& action,
                     const std::string& name = DEFAULT_WORKER_NAME);
 
     /**
@@ -120,17 +153,29 @@ class Worker {
     Worker& operator=(Worker&&) = delete;
 
     /**
-     * @brief Starts the Worker.
+     * @brief Starts the Worker, joining first the thread of a previous
+     *        stop(deadline). Does nothing if it is already running.
      */
     void start();
 
     /**
      * @brief Stops the Worker thread.
-     * @param mode Stop behavior: waits for the current `pop()` cycle to finish,
-     *        letting the worker exit naturally at the next iteration.
+     *        Signals the stop token, then waits for the current `pop()` cycle
+     *        to finish, letting the worker exit naturally at the next iteration.
      */
     void stop();
 
+    /**
+     * @brief Requests a stop and waits up to a deadline for the element in
+     *        flight, if any, to be released. Does not join the thread;
+     *        stop() or the destructor does.
+     *        start() may be called afterwards.
+     * @param deadline Maximum time to wait for the current trabajo() call.
+     * @return true if no element is being processed any more, false if
+     *         trabajo() is still running after the deadline.
+     */
+    bool stop(std::chrono::milliseconds deadline);
+
     /******************************************************************/
 
     /* Private Methods */
@@ -141,6 +186,22 @@ class Worker {
      */
     void run();
 
+    /**
+     * @brief One loop iteration through `consume()`, processing the element in place.
+     */
+    void run_once(std::true_type);
+
+    /**
+     * @brief One loop iteration through `pop()`.
+     */
+    void run_once(std::false_type);
+
+    /**
+     * @brief Hand an element to the action and report it if the action
+     *        abandoned it, or without starting it if the stop came first.
+     */
+    void process(const T& dato);
+
     /******************************************************************/
 
     /* Private Attributes */
@@ -149,7 +210,7 @@ class Worker {
     /**
      * @brief Cola used by the worker.
      */
-    Cola<T>& cola;
+    Queue& cola;
 
     /**
      * @brief The worker action interface.
@@ -171,6 +232,26 @@ class Worker {
      */
     std::atomic<bool> running;
 
+    /**
+     * @brief Signalled by stop(); its token is lent to the action with every element.
+     */
+    StopSource stop_source;
+
+    /**
+     * @brief Whether an element is being processed. Only set under busy_mtx.
+     */
+    std::atomic<bool> busy;
+
+    /**
+     * @brief Mutex of idle_cv.
+     */
+    std::mutex busy_mtx;
+
+    /**
+     * @brief Notified when an element is released after a stop request.
+     */
+    std::condition_variable idle_cv;
+
     /******************************************************************/
 };
 
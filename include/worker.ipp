@@ -26,8 +26,8 @@
 #include "worker.h"
 
 // Definition required for constexpr static data members of non-integral types
-template <typename T>
-constexpr std::chrono::seconds Worker<T>::DEFAULT_WAIT_TIMEOUT;
+template <typename T, typename Queue>
+constexpr std::chrono::seconds Worker<T, Queue>::DEFAULT_WAIT_TIMEOUT;
 
 /*****************************************************************************/
 
@@ -37,16 +37,16 @@ constexpr std::chrono::seconds Worker<T>::DEFAULT_WAIT_TIMEOUT;
  * @details Implementation of the Worker constructor.
  *          Initializes references to the queue and action, and sets the worker name.
  */
-template <typename T>
-Worker<T>::Worker(Cola<T>& cola, IWorkerAction<T>& action, const std::string& name)
-    : cola(cola), action(action), name(name), running(false) {}
+template <typename T, typename Queue>
+Worker<T, Queue>::Worker(Queue& cola, IWorkerAction<T>& action, const std::string& name)
+    : cola(cola), action(action), name(name), running(false), busy(false) {}
 
 /**
  * @details Ensures the worker thread has finished
  *          before destruction (joins the thread if needed)
  */
-template <typename T>
-Worker<T>::~Worker() {
+template <typename T, typename Queue>
+Worker<T, Queue>::~Worker() {
     stop();
     if (thread.joinable()) {
         thread.join();
@@ -57,16 +57,27 @@ Worker<T>::~Worker() {
 /**
  * @details Starts the worker by setting the running flag to true
  *          and launching a dedicated thread that executes the run() loop.
+ *          Does nothing if it is already running. A thread left behind by
+ *          stop(deadline) is joined first, so this may block until its
+ *          current iteration ends.
  */
-template <typename T>
-void Worker<T>::start() {
+template <typename T, typename Queue>
+void Worker<T, Queue>::start() {
+    if (running) return;
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+    stop_source.reset();
     running = true;
-    thread = std::thread(&Worker<T>::run, this);
+    thread = std::thread(&Worker<T, Queue>::run, this);
 }
 
 /**
- * @details Stops the worker activity by setting its running flag to false.
- *          The worker thread will complete its current loop iteration and then exit.
+ * @details Stops the worker activity by setting its running flag to false
+ *          and signalling the stop token, so the action may cut the current
+ *          element short. The worker thread will complete its current loop
+ *          iteration and then exit.
  *          This does not affect the underlying queue.
  * @note stop() does not interrupt pop() immediately.
  *       If the worker is waiting in pop(), it will exit
@@ -74,36 +85,97 @@ void Worker<T>::start() {
  *       This simplifies the design and avoids pushing
  *       shutdown logic into the queue.
  */
-template <typename T>
-void Worker<T>::stop() {
-    if (!running) return;
+template <typename T, typename Queue>
+void Worker<T, Queue>::stop() {
+    if (!running && !thread.joinable()) return;
 
     running = false;
+    stop_source.request_stop();
     if (thread.joinable()) {
         thread.join();
     }
 }
 
+/**
+ * @details busy is only set under busy_mtx after checking the stop (see
+ *          process()), so once the stop is requested no new element can
+ *          become busy. busy and the stop flag are both sequentially
+ *          consistent: either the worker sees the stop after releasing the
+ *          element and notifies idle_cv, or this thread sees busy already
+ *          false.
+ */
+template <typename T, typename Queue>
+bool Worker<T, Queue>::stop(std::chrono::milliseconds deadline) {
+    running = false;
+    stop_source.request_stop();
+    std::unique_lock<std::mutex> lock(busy_mtx);
+    return idle_cv.wait_for(lock, deadline, [this] { return !busy.load(); });
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
 /**
  * @details Main worker loop.
- *          Attempts to pop elements from the queue with a timeout.
+ *          Attempts to take elements from the queue with a timeout.
  *           - If an element is retrieved, it delegates processing to `action.trabajo()`.
  *           - If the queue is empty and the timeout expires, it calls `action.colaVacia()`.
+ *          The iteration uses `consume()` when the queue provides it, `pop()` otherwise.
  */
-template <typename T>
-void Worker<T>::run() {
+template <typename T, typename Queue>
+void Worker<T, Queue>::run() {
     while (running) {
-        auto extracted_data = cola.pop(DEFAULT_WAIT_TIMEOUT);
-        if (!extracted_data) {
-            action.colaVacia(name, DEFAULT_WAIT_TIMEOUT);
-        } else {
-            action.trabajo(name, *extracted_data);
-        }
+        run_once(QueueHasConsume<Queue, T>());
     }
 }
 
-/*****************************************************************************/
+template <typename T, typename Queue>
+void Worker<T, Queue>::run_once(std::true_type) {
+    const bool consumed = cola.consume([this](T& dato) { process(dato); }, DEFAULT_WAIT_TIMEOUT);
+    if (!consumed) {
+        action.colaVacia(name, DEFAULT_WAIT_TIMEOUT);
+    }
+}
 
-/* Private Methods */
+template <typename T, typename Queue>
+void Worker<T, Queue>::run_once(std::false_type) {
+    auto extracted_data = cola.pop(DEFAULT_WAIT_TIMEOUT);
+    if (!extracted_data) {
+        action.colaVacia(name, DEFAULT_WAIT_TIMEOUT);
+    } else {
+        process(*extracted_data);
+    }
+}
+
+/**
+ * @details The element is already out of the queue when this runs, so
+ *          stop(deadline) may have returned while busy was still false.
+ *          busy is therefore set under busy_mtx together with a check of
+ *          the stop: an element arriving after the stop is reported as
+ *          abandoned without being started, and one started before it
+ *          keeps stop(deadline) waiting.
+ */
+template <typename T, typename Queue>
+void Worker<T, Queue>::process(const T& dato) {
+    {
+        std::lock_guard<std::mutex> lock(busy_mtx);
+        if (!stop_source.stop_requested()) {
+            busy.store(true);
+        }
+    }
+    if (!busy.load()) {
+        action.onAbandoned(name, dato);
+        return;
+    }
+    if (!action.trabajo_cancelable(name, dato, stop_source.get_token())) {
+        action.onAbandoned(name, dato);
+    }
+    busy.store(false);
+    if (stop_source.stop_requested()) {
+        std::lock_guard<std::mutex> lock(busy_mtx);
+        idle_cv.notify_all();
+    }
+}
 
 /*****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,30 @@
+/**
+ * @file        console_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Log sink writing to the standard output stream.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <iostream>
+
+/* Project libraries */
+
+#include "console_sink.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+void ConsoleSink::write(const LogRecord& record) {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout.write(record.data, static_cast<std::streamsize>(record.size));
+    std::cout.flush();
+}
+
+/*****************************************************************************/
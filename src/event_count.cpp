@@ -0,0 +1,128 @@
+/**
+ * @file        event_count.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Event count: blocking and wake-up primitive for queues.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <climits>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* Project libraries */
+
+#include "event_count.h"
+
+/*****************************************************************************/
+
+/* Private Functions */
+
+#if defined(__linux__)
+
+namespace {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "The futex word must be a plain 32-bit integer");
+
+uint32_t* futex_word(std::atomic<uint32_t>& word) { return reinterpret_cast<uint32_t*>(&word); }
+
+/**
+ * @brief Sleep while *word == expected, for at most `timeout`.
+ *        May return early (signal, spurious wake-up, value already changed).
+ */
+void futex_wait(std::atomic<uint32_t>& word, uint32_t expected, const timespec& timeout) {
+    ::syscall(SYS_futex, futex_word(word), FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+}
+
+void futex_wake(std::atomic<uint32_t>& word, int count) {
+    ::syscall(SYS_futex, futex_word(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+}  // namespace
+
+#endif
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+EventCount::EventCount() : epoch(0), waiters(0) {}
+
+/**
+ * @details The waiter is counted before the epoch is read. Together with
+ *          wake(), which advances the epoch before reading the count (all
+ *          sequentially consistent), either the notifier sees the waiter and
+ *          wakes it, or the waiter reads the new epoch and does not sleep.
+ */
+EventCount::Key EventCount::prepare_wait() {
+    waiters.fetch_add(1);
+    return epoch.load();
+}
+
+void EventCount::cancel_wait() { waiters.fetch_sub(1); }
+
+bool EventCount::commit_wait(Key key, std::chrono::steady_clock::time_point until) {
+    bool notified = true;
+#if defined(__linux__)
+    while (epoch.load() == key) {
+        const auto remaining = until - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero()) {
+            notified = false;
+            break;
+        }
+        const auto secs = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+        const auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - secs);
+        timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(secs.count());
+        timeout.tv_nsec = static_cast<long>(nsecs.count());
+        futex_wait(epoch, key, timeout);
+    }
+#else
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        notified = cv.wait_until(lock, until, [this, key] { return epoch.load() != key; });
+    }
+#endif
+    waiters.fetch_sub(1);
+    return notified;
+}
+
+void EventCount::notify() { wake(1); }
+
+void EventCount::notify_all() { wake(INT_MAX); }
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void EventCount::wake(int count) {
+    epoch.fetch_add(1);
+    if (waiters.load() == 0) {
+        return;  // Nobody registered: no system call
+    }
+#if defined(__linux__)
+    futex_wake(epoch, count);
+#else
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+    }
+    if (count == 1) {
+        cv.notify_one();
+    } else {
+        cv.notify_all();
+    }
+#endif
+}
+
+/*****************************************************************************/
@@ -0,0 +1,289 @@
+/**
+ * @file        file_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Buffered, rotating file destination for the Logger.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* Project libraries */
+
+#include "file_sink.h"
+
+/*****************************************************************************/
+
+/* Private Constants */
+
+namespace {
+
+/**
+ * @brief Maximum number of recycled buffers kept by the sink.
+ */
+constexpr size_t MAX_SPARE_BUFFERS = 4;
+
+/**
+ * @brief Open a file for appending, creating it if needed.
+ */
+int open_append(const std::string& path) {
+#if defined(_WIN32)
+    return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY,
+                   _S_IREAD | _S_IWRITE);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+}
+
+/**
+ * @brief Current size of an open file.
+ */
+uint64_t file_length(int fd) {
+#if defined(_WIN32)
+    const long long end = ::_lseeki64(fd, 0, SEEK_END);
+#else
+    const off_t end = ::lseek(fd, 0, SEEK_END);
+#endif
+    return end < 0 ? 0 : static_cast<uint64_t>(end);
+}
+
+/**
+ * @brief Write the whole range, retrying on partial writes and EINTR.
+ * @return true if every byte was written.
+ */
+bool write_fully(int fd, const char* data, size_t len) {
+    while (len > 0) {
+#if defined(_WIN32)
+        const int n = ::_write(fd, data, static_cast<unsigned int>(len));
+#else
+        const ssize_t n = ::write(fd, data, len);
+#endif
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void close_fd(int fd) {
+#if defined(_WIN32)
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+FileSink::FileSink(const Options& options)
+    : options(options),
+      pending_bytes(0),
+      sealed_seq(0),
+      written_seq(0),
+      stopping(false),
+      fd(-1),
+      file_size(0),
+      written_total(0),
+      dropped_total(0),
+      rotation_count(0) {
+    open_file();
+    if (fd < 0) {
+        throw std::runtime_error("FileSink: cannot open " + options.path);
+    }
+    next_rotation = std::chrono::steady_clock::now() + options.rotation_interval;
+    active.reserve(options.buffer_size);
+    writer = std::thread(&FileSink::run, this);
+}
+
+FileSink::~FileSink() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_one();
+    if (writer.joinable()) {
+        writer.join();
+    }
+    close_file();
+}
+
+void FileSink::write(const LogRecord& record) { write(record.data, record.size); }
+
+void FileSink::write(const char* data, size_t len) {
+    bool sealed = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (pending_bytes + len > options.max_pending_bytes) {
+            dropped_total.fetch_add(len, std::memory_order_relaxed);
+            return;
+        }
+        if (!active.empty() && active.size() + len > options.buffer_size) {
+            seal_active_locked();
+            sealed = true;
+        }
+        active.insert(active.end(), data, data + len);
+        pending_bytes += len;
+    }
+    if (sealed) {
+        cv.notify_one();
+    }
+}
+
+void FileSink::flush() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!active.empty()) {
+        seal_active_locked();
+    }
+    const uint64_t target = sealed_seq;
+    cv.notify_one();
+    flushed_cv.wait(lock, [this, target] { return written_seq >= target; });
+}
+
+uint64_t FileSink::bytes_written() const { return written_total.load(std::memory_order_relaxed); }
+
+uint64_t FileSink::bytes_dropped() const { return dropped_total.load(std::memory_order_relaxed); }
+
+uint64_t FileSink::rotations() const { return rotation_count.load(std::memory_order_relaxed); }
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details Writes sealed buffers in order. When idle for a whole flush
+ *          interval, the partially filled active buffer is sealed too, which
+ *          bounds the time a record can stay in memory. Time-based rotation
+ *          is also checked while idle so that quiet periods still rotate.
+ */
+void FileSink::run() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        if (pending.empty()) {
+            cv.wait_for(lock, options.flush_interval,
+                        [this] { return stopping || !pending.empty(); });
+            if (pending.empty() && !active.empty()) {
+                seal_active_locked();
+            }
+            if (pending.empty()) {
+                if (stopping) break;
+                if (options.rotation_interval.count() > 0 && file_size > 0 &&
+                    std::chrono::steady_clock::now() >= next_rotation) {
+                    lock.unlock();
+                    rotate();
+                    lock.lock();
+                }
+                continue;
+            }
+        }
+
+        std::vector<char> buf = std::move(pending.front());
+        pending.pop_front();
+        lock.unlock();
+
+        write_buffer(buf);
+
+        lock.lock();
+        pending_bytes -= buf.size();
+        ++written_seq;
+        if (spare.size() < MAX_SPARE_BUFFERS) {
+            buf.clear();
+            spare.push_back(std::move(buf));
+        }
+        flushed_cv.notify_all();
+    }
+}
+
+/**
+ * @details Buffers only contain whole records, so rotating between buffers
+ *          never splits a record. A file may exceed `max_file_size` by at most
+ *          one buffer.
+ */
+void FileSink::write_buffer(const std::vector<char>& buf) {
+    if (buf.empty()) return;
+
+    const bool size_exceeded =
+        options.max_file_size > 0 && file_size > 0 && file_size + buf.size() > options.max_file_size;
+    const bool time_exceeded = options.rotation_interval.count() > 0 && file_size > 0 &&
+                               std::chrono::steady_clock::now() >= next_rotation;
+    if (size_exceeded || time_exceeded) {
+        rotate();
+    }
+
+    if (fd >= 0 && write_fully(fd, buf.data(), buf.size())) {
+        file_size += buf.size();
+        written_total.fetch_add(buf.size(), std::memory_order_relaxed);
+    } else {
+        dropped_total.fetch_add(buf.size(), std::memory_order_relaxed);
+    }
+}
+
+void FileSink::rotate() {
+    close_file();
+
+    if (options.max_files == 0) {
+        std::remove(options.path.c_str());
+    } else {
+        const std::string oldest = options.path + "." + std::to_string(options.max_files);
+        std::remove(oldest.c_str());
+        for (size_t i = options.max_files - 1; i >= 1; --i) {
+            const std::string from = options.path + "." + std::to_string(i);
+            const std::string to = options.path + "." + std::to_string(i + 1);
+            std::rename(from.c_str(), to.c_str());
+        }
+        const std::string first = options.path + ".1";
+        std::rename(options.path.c_str(), first.c_str());
+    }
+
+    open_file();
+    next_rotation = std::chrono::steady_clock::now() + options.rotation_interval;
+    rotation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FileSink::open_file() {
+    fd = open_append(options.path);
+    file_size = fd >= 0 ? file_length(fd) : 0;
+}
+
+void FileSink::close_file() {
+    if (fd >= 0) {
+        close_fd(fd);
+        fd = -1;
+    }
+}
+
+void FileSink::seal_active_locked() {
+    pending.push_back(std::move(active));
+    ++sealed_seq;
+    if (!spare.empty()) {
+        active = std::move(spare.back());
+        spare.pop_back();
+    } else {
+        active = std::vector<char>();
+        active.reserve(options.buffer_size);
+    }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,338 @@
+/**
+ * @file        flight_recorder.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       In-memory ring of recent log records, dumped on demand or on crash.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* Project libraries */
+
+#include "flight_recorder.h"
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Private Data Types */
+
+namespace {
+
+/**
+ * @brief One captured record. `seq` is odd while the owner thread writes the slot.
+ */
+struct Entry {
+    std::atomic<uint64_t> seq{0};
+    int64_t time_ns;
+    int level;
+    uint32_t len;
+    char text[FlightRecorder::TEXT_CAPACITY];
+};
+
+/**
+ * @brief Ring owned by one thread at a time. Rings are never freed so that
+ *        records of exited threads survive until the next dump.
+ */
+struct ThreadRing {
+    std::atomic<bool> owned{true};
+    std::atomic<uint64_t> head{0};
+    size_t capacity;
+    size_t id;
+    Entry* entries;
+};
+
+/**
+ * @brief Releases the thread's ring for reuse when the thread exits.
+ */
+struct RingHandle {
+    ThreadRing* ring = nullptr;
+    bool attempted = false;
+
+    ~RingHandle() {
+        if (ring) {
+            ring->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+std::atomic<ThreadRing*> rings[FlightRecorder::MAX_THREADS];
+std::atomic<size_t> ringCount{0};
+thread_local RingHandle handle;
+
+/**
+ * @brief Reuse a ring released by an exited thread, or create a new one.
+ */
+ThreadRing* acquire_ring(size_t capacity) {
+    const size_t count = std::min(ringCount.load(std::memory_order_acquire),
+                                  FlightRecorder::MAX_THREADS);
+    for (size_t i = 0; i < count; ++i) {
+        ThreadRing* ring = rings[i].load(std::memory_order_acquire);
+        bool expected = false;
+        if (ring && ring->owned.compare_exchange_strong(expected, true)) {
+            return ring;
+        }
+    }
+
+    const size_t slot = ringCount.fetch_add(1, std::memory_order_acq_rel);
+    if (slot >= FlightRecorder::MAX_THREADS) {
+        return nullptr;
+    }
+    ThreadRing* ring = new ThreadRing;
+    ring->capacity = capacity;
+    ring->id = slot;
+    ring->entries = new Entry[capacity];
+    rings[slot].store(ring, std::memory_order_release);
+    return ring;
+}
+
+/*****************************************************************************/
+
+/* Async-signal-safe output helpers */
+
+/**
+ * @brief Small fixed buffer used to build one output line without allocating.
+ */
+struct LineBuffer {
+    char data[FlightRecorder::TEXT_CAPACITY + 96];
+    size_t size = 0;
+
+    void append(const char* text, size_t len) {
+        len = std::min(len, sizeof(data) - size);
+        std::memcpy(data + size, text, len);
+        size += len;
+    }
+
+    void append(const char* text) { append(text, std::strlen(text)); }
+
+    void append_uint(uint64_t value, int min_digits = 1) {
+        char digits[20];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0 || n < min_digits);
+        while (n > 0 && size < sizeof(data)) {
+            data[size++] = digits[--n];
+        }
+    }
+};
+
+void write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+#if defined(_WIN32)
+        const int n = ::_write(fd, data, static_cast<unsigned int>(len));
+#else
+        const ssize_t n = ::write(fd, data, len);
+#endif
+        if (n <= 0) return;
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+}
+
+const char* level_name(int level) {
+    switch (level) {
+        case 0:
+            return "DEBUG";
+        case 1:
+            return "INFO";
+        case 2:
+            return "WARN";
+        case 3:
+            return "ERROR";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+constexpr size_t FlightRecorder::TEXT_CAPACITY;
+constexpr size_t FlightRecorder::MAX_THREADS;
+
+std::atomic<bool> FlightRecorder::active{false};
+std::atomic<size_t> FlightRecorder::ringCapacity{4096};
+char FlightRecorder::signalDumpPath[512] = {};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+void FlightRecorder::start(size_t records_per_thread, LogLevel lvl) {
+    ringCapacity.store(records_per_thread > 0 ? records_per_thread : 1);
+    active.store(true);
+    Logger::enable_capture(lvl);
+}
+
+void FlightRecorder::stop() {
+    Logger::disable_capture();
+    active.store(false);
+}
+
+/**
+ * @details Runs on the logging thread: a seqlock-protected memcpy into the
+ *          next slot of the thread's own ring.
+ */
+void FlightRecorder::record(LogLevel lvl, const char* msg, size_t len) {
+    if (!active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    RingHandle& h = handle;
+    if (!h.ring) {
+        if (h.attempted) return;
+        h.attempted = true;
+        h.ring = acquire_ring(ringCapacity.load(std::memory_order_relaxed));
+        if (!h.ring) return;
+    }
+
+    ThreadRing& ring = *h.ring;
+    const uint64_t idx = ring.head.load(std::memory_order_relaxed);
+    Entry& e = ring.entries[idx % ring.capacity];
+
+    e.seq.store(2 * idx + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    e.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+    e.level = static_cast<int>(lvl);
+    e.len = static_cast<uint32_t>(std::min(len, TEXT_CAPACITY));
+    std::memcpy(e.text, msg, e.len);
+
+    e.seq.store(2 * idx + 2, std::memory_order_release);
+    ring.head.store(idx + 1, std::memory_order_release);
+}
+
+bool FlightRecorder::dump(const char* path) {
+#if defined(_WIN32)
+    const int fd = ::_open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+    if (fd < 0) {
+        return false;
+    }
+    dump_fd(fd);
+#if defined(_WIN32)
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+    return true;
+}
+
+bool FlightRecorder::install_signal_handlers(const std::string& path) {
+#if defined(_WIN32)
+    (void)path;
+    return false;
+#else
+    if (path.size() >= sizeof(signalDumpPath)) {
+        return false;
+    }
+    std::memcpy(signalDumpPath, path.c_str(), path.size() + 1);
+
+    struct sigaction dump_action {};
+    dump_action.sa_handler = &FlightRecorder::on_signal;
+    sigemptyset(&dump_action.sa_mask);
+    dump_action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &dump_action, nullptr);
+
+    struct sigaction fatal_action {};
+    fatal_action.sa_handler = &FlightRecorder::on_signal;
+    sigemptyset(&fatal_action.sa_mask);
+    fatal_action.sa_flags = SA_RESETHAND | SA_NODEFER;
+    for (int sig : {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT}) {
+        sigaction(sig, &fatal_action, nullptr);
+    }
+    return true;
+#endif
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details Writes the rings one after the other, each oldest first, as
+ *          "[seconds.micros] [LEVEL] [T<ring>] message". Slots whose
+ *          sequence changes while being copied are skipped.
+ */
+void FlightRecorder::dump_fd(int fd) {
+    static const char header[] = "=== flight recorder dump ===\n";
+    write_all(fd, header, sizeof(header) - 1);
+
+    const size_t count = std::min(ringCount.load(std::memory_order_acquire), MAX_THREADS);
+    for (size_t r = 0; r < count; ++r) {
+        const ThreadRing* ring = rings[r].load(std::memory_order_acquire);
+        if (!ring) continue;
+
+        const uint64_t head = ring->head.load(std::memory_order_acquire);
+        const uint64_t first = head > ring->capacity ? head - ring->capacity : 0;
+        for (uint64_t idx = first; idx < head; ++idx) {
+            const Entry& e = ring->entries[idx % ring->capacity];
+            const uint64_t expected = 2 * idx + 2;
+            if (e.seq.load(std::memory_order_acquire) != expected) continue;
+
+            const int64_t time_ns = e.time_ns;
+            const int level = e.level;
+            const uint32_t len = std::min<uint32_t>(e.len, TEXT_CAPACITY);
+            char text[TEXT_CAPACITY];
+            std::memcpy(text, e.text, len);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (e.seq.load(std::memory_order_relaxed) != expected) continue;
+
+            LineBuffer line;
+            line.append("[");
+            line.append_uint(static_cast<uint64_t>(time_ns) / 1000000000u);
+            line.append(".");
+            line.append_uint((static_cast<uint64_t>(time_ns) / 1000u) % 1000000u, 6);
+            line.append("] [");
+            line.append(level_name(level));
+            line.append("] [T");
+            line.append_uint(ring->id);
+            line.append("] ");
+            line.append(text, len);
+            line.append("\n");
+            write_all(fd, line.data, line.size);
+        }
+    }
+}
+
+void FlightRecorder::on_signal(int sig) {
+    dump(signalDumpPath);
+#if !defined(_WIN32)
+    if (sig != SIGUSR1) {
+        // The handler was reset by SA_RESETHAND: re-raise with the default action
+        std::raise(sig);
+    }
+#else
+    (void)sig;
+#endif
+}
+
+/*****************************************************************************/
@@ -0,0 +1,168 @@
+/**
+ * @file        log_rate_limiter.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free rate limiter for repetitive log statements.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+/* Project libraries */
+
+#include "log_rate_limiter.h"
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+namespace {
+
+using Ticks = std::chrono::steady_clock::rep;
+
+/**
+ * @brief Value of next_due when no count is pending.
+ */
+constexpr Ticks NEVER = std::numeric_limits<Ticks>::max();
+
+/**
+ * @brief Earliest end of a window with a pending suppressed count.
+ */
+std::atomic<Ticks> next_due{NEVER};
+
+/**
+ * @struct Registry
+ * @brief Every live limiter, for flush_pending().
+ */
+struct Registry {
+    std::mutex mtx;                        /**< Protects limiters. */
+    std::vector<LogRateLimiter*> limiters; /**< Registered limiters. */
+};
+
+/**
+ * @brief The registry, built by the first limiter so it outlives all of them.
+ */
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+Ticks now_ticks() { return std::chrono::steady_clock::now().time_since_epoch().count(); }
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+LogRateLimiter::LogRateLimiter(uint32_t max_per_interval, std::chrono::milliseconds interval,
+                               LogLevel level, const char* site)
+    : max_per_interval(max_per_interval),
+      interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval).count()),
+      window_start(now_ticks()),
+      count(0),
+      suppressed_count(0),
+      level(level),
+      site(site) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    reg.limiters.push_back(this);
+}
+
+LogRateLimiter::~LogRateLimiter() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    reg.limiters.erase(std::remove(reg.limiters.begin(), reg.limiters.end(), this),
+                       reg.limiters.end());
+}
+
+/**
+ * @details The first thread to observe an expired window moves it forward
+ *          with a CAS and resets the counter; the others simply count in
+ *          whichever window they observe.
+ */
+bool LogRateLimiter::allow(uint64_t& suppressed) {
+    const auto now = now_ticks();
+    auto start = window_start.load(std::memory_order_relaxed);
+    if (now - start >= interval &&
+        window_start.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+        count.store(0, std::memory_order_relaxed);
+    }
+
+    if (count.fetch_add(1, std::memory_order_relaxed) < max_per_interval) {
+        suppressed = suppressed_count.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (suppressed_count.fetch_add(1, std::memory_order_relaxed) == 0) {
+        schedule_flush(window_start.load(std::memory_order_relaxed) + interval);
+    }
+    return false;
+}
+
+/**
+ * @details Only the thread that moves next_due back to NEVER scans the
+ *          registry, so a due flush is not repeated by every logging
+ *          thread. Counts are taken with an exchange, so a record accepted
+ *          concurrently and a flush never report the same suppression.
+ *          Sites whose window is still open are scheduled again.
+ */
+void LogRateLimiter::flush_pending(PendingHandler handler, bool all) {
+    const Ticks now = now_ticks();
+    if (!all) {
+        Ticks due = next_due.load(std::memory_order_relaxed);
+        if (now < due || !next_due.compare_exchange_strong(due, NEVER)) {
+            return;
+        }
+    }
+
+    struct Pending {
+        LogLevel level;
+        const char* site;
+        uint64_t suppressed;
+    };
+    std::vector<Pending> pending;
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mtx);
+        for (LogRateLimiter* limiter : reg.limiters) {
+            if (limiter->suppressed_count.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            const Ticks end = limiter->window_start.load(std::memory_order_relaxed) +
+                              limiter->interval;
+            if (!all && now < end) {
+                schedule_flush(end);
+                continue;
+            }
+            const uint64_t suppressed =
+                limiter->suppressed_count.exchange(0, std::memory_order_relaxed);
+            if (suppressed > 0) {
+                pending.push_back(Pending{limiter->level, limiter->site, suppressed});
+            }
+        }
+    }
+    for (const Pending& entry : pending) {
+        handler(entry.level, entry.site, entry.suppressed);
+    }
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void LogRateLimiter::schedule_flush(Ticks due) {
+    Ticks current = next_due.load(std::memory_order_relaxed);
+    while (due < current && !next_due.compare_exchange_weak(current, due)) {
+    }
+}
+
+/*****************************************************************************/
@@ -11,22 +11,38 @@
 
 /* Standard libraries */
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
-#include <iostream>
 #include <sstream>
 
 /* Project libraries */
 
+#include "console_sink.h"
+#include "flight_recorder.h"
 #include "logger.h"
 
 /*****************************************************************************/
 
 /* Static member initialization */
 
+namespace {
+
+/**
+ * @brief Value of the cached threshold when no sink is registered.
+ */
+constexpr int LEVEL_OFF = static_cast<int>(LogLevel::ERROR) + 1;
+
+}  // namespace
+
 std::mutex Logger::mtx;
 Logger::Level Logger::minLevel = Logger::Level::INFO;
+std::shared_ptr<const Logger::SinkList> Logger::sinks = std::make_shared<const Logger::SinkList>(
+    Logger::SinkList{{std::make_shared<ConsoleSink>(), Logger::Level::DBG}});
+std::atomic<int> Logger::deliverThreshold{static_cast<int>(Logger::Level::INFO)};
+std::atomic<int> Logger::captureLevel{LEVEL_OFF};
+std::atomic<int> Logger::threshold{static_cast<int>(Logger::Level::INFO)};
 
 /*****************************************************************************/
 
@@ -35,6 +51,53 @@ Logger::Level Logger::minLevel = Logger::Level::INFO;
 void Logger::set_min_level(Level lvl) {
     std::lock_guard<std::mutex> lock(mtx);
     minLevel = lvl;
+    publish(std::atomic_load(&sinks));
+}
+
+void Logger::add_sink(std::shared_ptr<ILogSink> sink, Level lvl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto list = std::make_shared<SinkList>(*std::atomic_load(&sinks));
+    list->push_back(SinkEntry{std::move(sink), lvl});
+    publish(std::move(list));
+}
+
+void Logger::remove_sink(const std::shared_ptr<ILogSink>& sink) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto list = std::make_shared<SinkList>();
+    for (const auto& entry : *std::atomic_load(&sinks)) {
+        if (entry.sink != sink) {
+            list->push_back(entry);
+        }
+    }
+    publish(std::move(list));
+}
+
+void Logger::set_sink_level(const std::shared_ptr<ILogSink>& sink, Level lvl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto list = std::make_shared<SinkList>(*std::atomic_load(&sinks));
+    for (auto& entry : *list) {
+        if (entry.sink == sink) {
+            entry.level = lvl;
+        }
+    }
+    publish(std::move(list));
+}
+
+void Logger::clear_sinks() {
+    std::lock_guard<std::mutex> lock(mtx);
+    publish(std::make_shared<const SinkList>());
+}
+
+void Logger::enable_capture(Level lvl) {
+    std::lock_guard<std::mutex> lock(mtx);
+    captureLevel.store(static_cast<int>(lvl), std::memory_order_relaxed);
+    publish(std::atomic_load(&sinks));
+}
+
+void Logger::disable_capture() {
+    std::lock_guard<std::mutex> lock(mtx);
+    captureLevel.store(LEVEL_OFF, std::memory_order_relaxed);
+    publish(std::atomic_load(&sinks));
 }
 
 void Logger::debug(const std::string& msg) { log(Level::DBG, msg); }
@@ -45,25 +108,82 @@ void Logger::warn(const std::string& msg) { log(Level::WARN, msg); }
 
 void Logger::error(const std::string& msg) { log(Level::ERROR, msg); }
 
-void Logger::log(Level lvl, const std::string& msg) {
-    std::lock_guard<std::mutex> lock(mtx);
-    if (static_cast<int>(lvl) < static_cast<int>(minLevel)) {
+/**
+ * @details Filters on the cached threshold before doing any work, then
+ *          reports rate-limited sites whose window ended (one load while
+ *          none is due). The raw message is captured by the FlightRecorder
+ *          if requested; then the record is formatted once and delivered to
+ *          every sink that accepts its level.
+ */
+void Logger::log(Level lvl, const std::string& msg) { log(lvl, msg.data(), msg.size()); }
+
+void Logger::log(Level lvl, const char* msg, size_t len) {
+    if (!enabled(lvl)) {
         return;
     }
+    LogRateLimiter::flush_pending(&Logger::report_suppressed);
+
+    if (static_cast<int>(lvl) >= captureLevel.load(std::memory_order_relaxed)) {
+        FlightRecorder::record(lvl, msg, len);
+    }
+    if (static_cast<int>(lvl) < deliverThreshold.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const std::shared_ptr<const SinkList> current = std::atomic_load(&sinks);
+    const std::string& line = format(lvl, msg, len);
+    const LogRecord record{lvl, line.data(), line.size()};
+    for (const auto& entry : *current) {
+        if (static_cast<int>(lvl) >= static_cast<int>(entry.level)) {
+            entry.sink->write(record);
+        }
+    }
+}
+
+void Logger::log_limited(Level lvl, const std::string& msg, uint64_t suppressed) {
+    if (suppressed == 0) {
+        log(lvl, msg);
+        return;
+    }
+    log(lvl, msg + " (suppressed " + std::to_string(suppressed) + " similar messages)");
+}
 
-    std::cout << "[" << timestamp() << "] " << "[" << levelToString(lvl) << "] " << msg
-              << std::endl;
+void Logger::flush_suppressed(bool all) {
+    LogRateLimiter::flush_pending(&Logger::report_suppressed, all);
 }
 
 /*****************************************************************************/
 
 /* Private Methods */
 
-std::string Logger::timestamp() {
+void Logger::publish(std::shared_ptr<const SinkList> list) {
+    int lowest = LEVEL_OFF;
+    for (const auto& entry : *list) {
+        lowest = std::min(lowest, static_cast<int>(entry.level));
+    }
+    const int deliver = std::max(lowest, static_cast<int>(minLevel));
+    std::atomic_store(&sinks, std::move(list));
+    deliverThreshold.store(deliver, std::memory_order_relaxed);
+    threshold.store(std::min(deliver, captureLevel.load(std::memory_order_relaxed)),
+                    std::memory_order_relaxed);
+}
+
+/**
+ * @details The formatted string only changes once per second, so each thread
+ *          caches the last one and reuses it instead of calling put_time for
+ *          every record.
+ */
+const std::string& Logger::timestamp() {
     using clock = std::chrono::system_clock;
     const auto now = clock::now();
     const std::time_t tt = clock::to_time_t(now);
 
+    thread_local std::time_t cachedTime = -1;
+    thread_local std::string cachedText;
+    if (tt == cachedTime) {
+        return cachedText;
+    }
+
     std::tm tm{};
 #if defined(_WIN32)
     localtime_s(&tm, &tt);
@@ -73,7 +193,35 @@ std::string Logger::timestamp() {
 
     std::ostringstream oss;
     oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-    return oss.str();
+    cachedTime = tt;
+    cachedText = oss.str();
+    return cachedText;
+}
+
+/**
+ * @details The line is built in a thread-local string whose capacity is kept
+ *          between records, so formatting does not allocate once the buffer
+ *          has grown to the usual message size.
+ */
+const std::string& Logger::format(Level lvl, const char* msg, size_t len) {
+    thread_local std::string line;
+    line.clear();
+    line += '[';
+    line += timestamp();
+    line += "] [";
+    line += levelToString(lvl);
+    line += "] ";
+    line.append(msg, len);
+    line += '\n';
+    return line;
+}
+
+void Logger::report_suppressed(Level lvl, const char* site, uint64_t suppressed) {
+    std::string msg(site);
+    if (!msg.empty()) {
+        msg += ": ";
+    }
+    log(lvl, msg + "suppressed " + std::to_string(suppressed) + " similar messages");
 }
 
 const char* Logger::levelToString(Level lvl) {
@@ -74,6 +74,8 @@ int main() {
     worker2.stop();
     worker3.stop();
 
+    Logger::flush_suppressed(true);
+
     return 0;
 }
 
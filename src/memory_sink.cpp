@@ -0,0 +1,47 @@
+/**
+ * @file        memory_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Log sink keeping the most recent records in memory.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "memory_sink.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+MemorySink::MemorySink(size_t capacity) : ring(capacity > 0 ? capacity : 1), next(0) {}
+
+void MemorySink::write(const LogRecord& record) {
+    std::lock_guard<std::mutex> lock(mtx);
+    ring[next % ring.size()].assign(record.data, record.size);
+    ++next;
+}
+
+std::vector<std::string> MemorySink::snapshot() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::string> out;
+    const size_t count = next < ring.size() ? next : ring.size();
+    out.reserve(count);
+    for (size_t i = next - count; i < next; ++i) {
+        out.push_back(ring[i % ring.size()]);
+    }
+    return out;
+}
+
+void MemorySink::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto& slot : ring) {
+        slot.clear();
+    }
+    next = 0;
+}
+
+/*****************************************************************************/
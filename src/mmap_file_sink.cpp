@@ -0,0 +1,300 @@
+/**
+ * @file        mmap_file_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Lock-free log sink writing into a memory-mapped file.
+ */
+
+/*****************************************************************************/
+
+#if !defined(_WIN32)
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Project libraries */
+
+#include "mmap_file_sink.h"
+
+/*****************************************************************************/
+
+/* Private Constants */
+
+namespace {
+
+/**
+ * @brief Marker of a segment whose end was not cut by an overflowing writer.
+ */
+constexpr size_t NO_VALID_END = std::numeric_limits<size_t>::max();
+
+size_t page_size() { return static_cast<size_t>(::sysconf(_SC_PAGESIZE)); }
+
+size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+MmapFileSink::MmapFileSink(const Options& options)
+    : options(options), current(nullptr), stopping(false), rollover_count(0), dropped_total(0) {
+    const size_t page = page_size();
+    this->options.region_size = round_up(std::max(options.region_size, page), page);
+
+    const int fd = ::open(options.path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("MmapFileSink: cannot open " + options.path);
+    }
+
+    // Continue after the existing content: map from its last page boundary
+    const off_t existing = ::lseek(fd, 0, SEEK_END);
+    const uint64_t length = existing > 0 ? static_cast<uint64_t>(existing) : 0;
+    const uint64_t offset = length / page * page;
+    Segment* seg = map_segment(fd, true, offset, static_cast<size_t>(length - offset));
+    if (!seg) {
+        ::close(fd);
+        throw std::runtime_error("MmapFileSink: cannot map " + options.path);
+    }
+    current.store(seg);
+
+    syncer = std::thread(&MmapFileSink::run, this);
+}
+
+MmapFileSink::~MmapFileSink() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    cv.notify_one();
+    if (syncer.joinable()) {
+        syncer.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (Segment* seg : retired) {
+        finalize(seg, false);
+    }
+    retired.clear();
+    finalize(current.load(), true);
+}
+
+void MmapFileSink::write(const LogRecord& record) { write(record.data, record.size); }
+
+/**
+ * @details Registers as a writer of the current segment, re-checking that
+ *          it is still current (sequentially consistent, so a segment seen
+ *          with no writers after being replaced is never touched again).
+ *          The fetch-add reserves [off, off + len); if that runs past the
+ *          end, the first such writer records where the data stops and the
+ *          next segment is mapped.
+ */
+void MmapFileSink::write(const char* data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    if (len > options.region_size) {
+        dropped_total.fetch_add(len, std::memory_order_relaxed);
+        return;
+    }
+
+    while (true) {
+        Segment* seg = current.load();
+        seg->writers.fetch_add(1);
+        if (current.load() != seg) {
+            seg->writers.fetch_sub(1);
+            continue;
+        }
+
+        const size_t off = seg->cursor.fetch_add(len, std::memory_order_relaxed);
+        if (off + len <= seg->size) {
+            std::memcpy(seg->base + off, data, len);
+            seg->writers.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        if (off < seg->size) {
+            seg->valid_end.store(off, std::memory_order_relaxed);
+        }
+        seg->writers.fetch_sub(1, std::memory_order_release);
+
+        if (!roll(seg)) {
+            dropped_total.fetch_add(len, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+void MmapFileSink::flush() {
+    std::lock_guard<std::mutex> lock(mtx);
+    Segment* seg = current.load();
+    const size_t used = std::min(seg->cursor.load(), seg->size);
+    if (used > 0) {
+        ::msync(seg->base, round_up(used, page_size()), MS_SYNC);
+    }
+}
+
+uint64_t MmapFileSink::rollovers() const { return rollover_count.load(std::memory_order_relaxed); }
+
+uint64_t MmapFileSink::bytes_dropped() const {
+    return dropped_total.load(std::memory_order_relaxed);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+MmapFileSink::Segment* MmapFileSink::map_segment(int fd, bool owns_fd, uint64_t file_offset,
+                                                 size_t start) {
+    const size_t size = options.region_size;
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        return nullptr;
+    }
+    if (static_cast<uint64_t>(st.st_size) < file_offset + size &&
+        ::ftruncate(fd, static_cast<off_t>(file_offset + size)) != 0) {
+        return nullptr;
+    }
+
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                        static_cast<off_t>(file_offset));
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Segment> seg(new Segment);
+    seg->fd = fd;
+    seg->owns_fd = owns_fd;
+    seg->base = static_cast<char*>(base);
+    seg->size = size;
+    seg->file_offset = file_offset;
+    seg->cursor.store(start);
+    seg->writers.store(0);
+    seg->valid_end.store(NO_VALID_END);
+    seg->finalized = false;
+    segments.push_back(std::move(seg));
+    return segments.back().get();
+}
+
+bool MmapFileSink::roll(Segment* seg) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (current.load() != seg) {
+        return true;  // Another writer already replaced it
+    }
+
+    Segment* next = nullptr;
+    if (options.when_full == FullPolicy::EXTEND) {
+        next = map_segment(seg->fd, seg->owns_fd, seg->file_offset + seg->size, 0);
+        if (next) {
+            seg->owns_fd = false;  // The descriptor now belongs to the new segment
+        }
+    } else {
+        const int fd = rotate_files();
+        if (fd >= 0) {
+            next = map_segment(fd, true, 0, 0);
+            if (!next) {
+                ::close(fd);
+            }
+        }
+    }
+    if (!next) {
+        return false;
+    }
+
+    current.store(next);
+    retired.push_back(seg);
+    rollover_count.fetch_add(1, std::memory_order_relaxed);
+    cv.notify_one();
+    return true;
+}
+
+int MmapFileSink::rotate_files() {
+    const std::string& path = options.path;
+    if (options.max_files == 0) {
+        std::remove(path.c_str());
+    } else {
+        std::remove((path + "." + std::to_string(options.max_files)).c_str());
+        for (size_t i = options.max_files - 1; i >= 1; --i) {
+            std::rename((path + "." + std::to_string(i)).c_str(),
+                        (path + "." + std::to_string(i + 1)).c_str());
+        }
+        std::rename(path.c_str(), (path + ".1").c_str());
+    }
+    return ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+}
+
+/**
+ * @details In EXTEND mode a retired segment is followed by the next region
+ *          in the same file, so its unused tail is blank-padded; otherwise
+ *          the file is truncated right after the data.
+ */
+void MmapFileSink::finalize(Segment* seg, bool last) {
+    if (seg->finalized) {
+        return;
+    }
+
+    const size_t cut = seg->valid_end.load();
+    const size_t end = cut != NO_VALID_END ? cut : std::min(seg->cursor.load(), seg->size);
+    const bool pad = options.when_full == FullPolicy::EXTEND && !last;
+    if (pad && end < seg->size) {
+        std::memset(seg->base + end, ' ', seg->size - end - 1);
+        seg->base[seg->size - 1] = '\n';
+    }
+
+    ::msync(seg->base, seg->size, MS_ASYNC);
+    ::munmap(seg->base, seg->size);
+    if (!pad) {
+        // On failure the file just keeps its zero-filled tail
+        const int rc = ::ftruncate(seg->fd, static_cast<off_t>(seg->file_offset + end));
+        (void)rc;
+    }
+    if (seg->owns_fd) {
+        ::close(seg->fd);
+    }
+    seg->finalized = true;
+}
+
+/**
+ * @details Retires full segments as soon as their last writer is gone and
+ *          schedules write-back of the active one every sync_interval.
+ */
+void MmapFileSink::run() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (!stopping) {
+        const auto wait = retired.empty() ? options.sync_interval : std::chrono::milliseconds(1);
+        cv.wait_for(lock, wait);
+
+        for (auto it = retired.begin(); it != retired.end();) {
+            if ((*it)->writers.load() == 0) {
+                finalize(*it, false);
+                it = retired.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        Segment* seg = current.load();
+        const size_t used = std::min(seg->cursor.load(), seg->size);
+        if (used > 0) {
+            ::msync(seg->base, round_up(used, page_size()), MS_ASYNC);
+        }
+    }
+}
+
+/*****************************************************************************/
+
+#endif  // !defined(_WIN32)
@@ -0,0 +1,93 @@
+/**
+ * @file        stop_token.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     1.0.0
+ *
+ * @brief       Cooperative cancellation flag with stop callbacks.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+
+/* Project libraries */
+
+#include "stop_token.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+StopSource::StopSource() : requested(false), next_id(1) {}
+
+/**
+ * @details Sequentially consistent, like the store in request_stop(), so
+ *          callers can pair it with their own flags (see Worker::stop()).
+ */
+bool StopSource::stop_requested(void) const { return requested.load(); }
+
+/**
+ * @details The flag is set under the lock, so add_callback() either
+ *          registers before the request (and the callback is taken here)
+ *          or sees the flag and runs the callback itself. The callbacks
+ *          are moved out and run without the lock.
+ */
+bool StopSource::request_stop() {
+    std::vector<std::pair<CallbackId, Callback>> pending;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (requested.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        requested.store(true);
+        pending.swap(callbacks);
+    }
+    for (std::pair<CallbackId, Callback>& entry : pending) {
+        entry.second();
+    }
+    return true;
+}
+
+void StopSource::reset() {
+    std::lock_guard<std::mutex> lock(mtx);
+    requested.store(false);
+}
+
+StopSource::CallbackId StopSource::add_callback(Callback callback) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!requested.load(std::memory_order_relaxed)) {
+            const CallbackId id = next_id++;
+            callbacks.emplace_back(id, std::move(callback));
+            return id;
+        }
+    }
+    callback();
+    return 0;
+}
+
+void StopSource::remove_callback(CallbackId id) {
+    std::lock_guard<std::mutex> lock(mtx);
+    callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(),
+                                   [id](const std::pair<CallbackId, Callback>& entry) {
+                                       return entry.first == id;
+                                   }),
+                    callbacks.end());
+}
+
+StopToken StopSource::get_token() { return StopToken(*this); }
+
+StopToken::StopToken(StopSource& source) : source(&source) {}
+
+bool StopToken::stop_requested(void) const { return source->stop_requested(); }
+
+StopToken::CallbackId StopToken::add_callback(Callback callback) {
+    return source->add_callback(std::move(callback));
+}
+
+void StopToken::remove_callback(CallbackId id) { source->remove_callback(id); }
+
+/*****************************************************************************/
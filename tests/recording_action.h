@@ -0,0 +1,84 @@
+/**
+ * @file        recording_action.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Test action recording what a Worker processed.
+ *
+ * @details
+ * Shared by the queue tests that drive a Worker: each processed element is
+ * turned into a `Record` (the element itself by default) and stored, and
+ * `wait_for()` blocks until enough records arrived.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_worker_action.h"
+
+/*****************************************************************************/
+
+/**
+ * @class RecordingAction
+ * @brief Action storing a record of every processed element.
+ * @tparam T Element type processed by the Worker.
+ * @tparam Record What is stored per element (for elements that cannot be copied).
+ */
+template <typename T, typename Record = T>
+class RecordingAction : public IWorkerAction<T> {
+   public:
+    /**
+     * @brief Builds the record of an element.
+     */
+    using Projection = std::function<Record(const T&)>;
+
+    /**
+     * @brief Constructor of the RecordingAction class.
+     * @param project Builds the record of each element; copies it by default.
+     */
+    explicit RecordingAction(Projection project = [](const T& dato) { return Record(dato); })
+        : project(std::move(project)) {}
+
+    void trabajo(const std::string&, const T& dato) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        records.push_back(project(dato));
+        cv.notify_all();
+    }
+
+    void colaVacia(const std::string&, const std::chrono::seconds) override {}
+
+    void onStop(const std::string&) override {}
+
+    /**
+     * @brief Wait up to 5 s until `count` elements were processed.
+     * @return The records so far, in processing order.
+     */
+    std::vector<Record> wait_for(size_t count) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::seconds(5), [&] { return records.size() >= count; });
+        return records;
+    }
+
+   private:
+    Projection project;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<Record> records;
+};
@@ -0,0 +1,148 @@
+/**
+ * @file        test_cola_event_fd.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for driving a Cola<T> through a ColaEventFd.
+ *
+ * @details
+ * These tests validate the behavior of `ColaEventFd`:
+ *  - The descriptor becomes readable on the empty to non-empty transition.
+ *  - A burst of pushes results in a single write.
+ *  - A queue can be drained from an epoll loop without blocking in pop().
+ */
+
+/*****************************************************************************/
+
+#if defined(__linux__)
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/* Project libraries */
+
+#include "cola.h"
+#include "cola_event_fd.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+bool is_readable(int fd) {
+    pollfd pfd{fd, POLLIN, 0};
+    return ::poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLIN);
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test SignalsOnceUntilCleared
+ * @brief Ensures a burst of pushes makes the descriptor readable with a
+ *        single write, and that it is re-armed once the queue is drained.
+ */
+TEST(ColaEventFdTest, SignalsOnceUntilCleared) {
+    Cola<int> cola(100);
+    auto event_fd = std::make_shared<ColaEventFd>();
+    cola.attach_event_fd(event_fd);
+    EXPECT_FALSE(is_readable(event_fd->fd()));
+
+    // Given: a burst of pushes into the empty queue
+    for (int i = 0; i < 50; i++) {
+        cola.push(i);
+    }
+
+    // Then: the descriptor is readable after one write
+    EXPECT_TRUE(is_readable(event_fd->fd()));
+    EXPECT_EQ(event_fd->get_writes(), 1u);
+
+    // When: clearing and draining
+    event_fd->clear();
+    int drained = 0;
+    while (cola.try_pop()) {
+        drained++;
+    }
+    EXPECT_EQ(drained, 50);
+    EXPECT_FALSE(is_readable(event_fd->fd()));
+
+    // Then: the next push signals again
+    cola.push(1);
+    EXPECT_TRUE(is_readable(event_fd->fd()));
+    EXPECT_EQ(event_fd->get_writes(), 2u);
+}
+
+/**
+ * @test AttachToNonEmptyQueueSignals
+ * @brief Ensures elements queued before the event fd is attached are not missed.
+ */
+TEST(ColaEventFdTest, AttachToNonEmptyQueueSignals) {
+    Cola<int> cola;
+    cola.push(7);
+
+    auto event_fd = std::make_shared<ColaEventFd>();
+    cola.attach_event_fd(event_fd);
+
+    EXPECT_TRUE(is_readable(event_fd->fd()));
+}
+
+/**
+ * @test DrainedFromEpollLoop
+ * @brief Ensures an epoll loop receives every element pushed by another thread.
+ */
+TEST(ColaEventFdTest, DrainedFromEpollLoop) {
+    constexpr int ELEMENTS = 1000;
+    Cola<int> cola(ELEMENTS);
+    auto event_fd = std::make_shared<ColaEventFd>();
+    cola.attach_event_fd(event_fd);
+
+    const int epfd = ::epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_GE(epfd, 0);
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = event_fd->fd();
+    ASSERT_EQ(::epoll_ctl(epfd, EPOLL_CTL_ADD, event_fd->fd(), &ev), 0);
+
+    // Given: a producer pushing from another thread
+    std::thread producer([&cola] {
+        for (int i = 0; i < ELEMENTS; i++) {
+            cola.push(i);
+        }
+    });
+
+    // When: the loop drains the queue on each readiness event
+    std::vector<int> received;
+    while (received.size() < static_cast<size_t>(ELEMENTS)) {
+        epoll_event ready{};
+        const int n = ::epoll_wait(epfd, &ready, 1, 2000);
+        ASSERT_EQ(n, 1);
+        event_fd->clear();
+        while (auto dato = cola.try_pop()) {
+            received.push_back(dato.value());
+        }
+    }
+    producer.join();
+    ::close(epfd);
+
+    // Then: everything arrives in order, with at most one write per push
+    for (int i = 0; i < ELEMENTS; i++) {
+        ASSERT_EQ(received[i], i);
+    }
+    EXPECT_LE(event_fd->get_writes(), static_cast<uint64_t>(ELEMENTS));
+}
+
+#endif  // defined(__linux__)
@@ -0,0 +1,148 @@
+/**
+ * @file        test_cola_producer.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the ColaProducer<T> class.
+ *
+ * @details
+ * These tests validate the behavior of the batching producer handle:
+ *  - Elements are published once the batch is full, in order.
+ *  - A batch older than the maximum delay is published.
+ *  - flush() and the destructor publish what is pending.
+ *  - Several producer threads lose no element.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+#include "cola_producer.h"
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test FlushesFullBatch
+ * @brief Ensures elements stay private until the batch is full, then
+ *        reach the queue in order with a single bulk push.
+ */
+TEST(ColaProducerTest, FlushesFullBatch) {
+    Cola<std::string> cola(10);
+    ColaProducer<std::string> producer(cola, 3, std::chrono::seconds(10));
+
+    // When: pushing fewer elements than the batch size
+    producer.push("a");
+    producer.push("b");
+
+    // Then: nothing is visible yet
+    EXPECT_TRUE(cola.is_empty());
+    EXPECT_EQ(producer.pending_count(), 2u);
+
+    // When: completing the batch
+    producer.push("c");
+
+    // Then: the whole batch is queued, in order
+    EXPECT_EQ(producer.pending_count(), 0u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "a");
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "b");
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "c");
+    EXPECT_EQ(cola.get_stats().pushed, 3u);
+}
+
+/**
+ * @test FlushesAfterMaxDelay
+ * @brief Ensures a batch is published once its oldest element reaches the maximum delay.
+ */
+TEST(ColaProducerTest, FlushesAfterMaxDelay) {
+    Cola<int> cola(10);
+    ColaProducer<int> producer(cola, 100, std::chrono::milliseconds(500));
+
+    // Given: a pending element
+    producer.push(1);
+    EXPECT_FALSE(producer.flush_if_due());
+    EXPECT_TRUE(cola.is_empty());
+
+    // When: the maximum delay passes
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+
+    // Then: the next check publishes it
+    EXPECT_TRUE(producer.flush_if_due());
+    EXPECT_EQ(cola.get_size(), 1u);
+
+    // When: a push finds the batch overdue
+    producer.push(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    producer.push(3);
+
+    // Then: both elements are published by that push
+    EXPECT_EQ(producer.pending_count(), 0u);
+    EXPECT_EQ(cola.get_size(), 3u);
+}
+
+/**
+ * @test FlushOnDemandAndDestruction
+ * @brief Ensures flush() and the destructor publish the pending elements.
+ */
+TEST(ColaProducerTest, FlushOnDemandAndDestruction) {
+    Cola<int> cola(10);
+    {
+        ColaProducer<int> producer(cola, 100, std::chrono::seconds(10));
+        producer.push(1);
+        producer.flush();
+        EXPECT_EQ(cola.get_size(), 1u);
+
+        // When: the handle goes away with an element pending
+        producer.push(2);
+    }
+
+    // Then: it was published
+    EXPECT_EQ(cola.get_size(), 2u);
+}
+
+/**
+ * @test ConcurrentProducers
+ * @brief Ensures batches from several threads all arrive, each thread in order.
+ */
+TEST(ColaProducerTest, ConcurrentProducers) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 10000;
+    Cola<std::pair<int, int>> cola(PRODUCERS * PER_PRODUCER);
+
+    // Given: producers pushing through their own handle
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&cola, p] {
+            ColaProducer<std::pair<int, int>> producer(cola, 16);
+            for (int i = 0; i < PER_PRODUCER; i++) {
+                producer.push(std::make_pair(p, i));
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    // When: draining the queue
+    // Then: nothing was lost and each producer's elements are in order
+    std::vector<int> next(PRODUCERS, 0);
+    for (int received = 0; received < PRODUCERS * PER_PRODUCER; received++) {
+        auto dato = cola.pop(std::chrono::seconds(0));
+        ASSERT_TRUE(dato.has_value());
+        ASSERT_EQ(dato->second, next[dato->first]);
+        next[dato->first]++;
+    }
+    EXPECT_TRUE(cola.is_empty());
+}
@@ -0,0 +1,154 @@
+/**
+ * @file        test_cola_selector.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the ColaSelector<T> class.
+ *
+ * @details
+ * These tests validate the behavior of `ColaSelector`:
+ *  - Strict priority serves earlier queues first.
+ *  - Weighted selection serves each busy queue by its weight.
+ *  - A blocked pop() wakes up on a push to any of the queues.
+ *  - Queue callbacks run while popping may use the selector.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola_selector.h"
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test StrictPriorityServesFirstQueueFirst
+ * @brief Ensures a lower priority queue is only served once the higher one is empty.
+ */
+TEST(ColaSelectorTest, StrictPriorityServesFirstQueueFirst) {
+    Cola<std::string> high(10);
+    Cola<std::string> low(10);
+    ColaSelector<std::string> selector;
+    selector.add(high);
+    selector.add(low);
+
+    // Given: elements in both queues, the low priority ones pushed first
+    low.push("l1");
+    low.push("l2");
+    high.push("h1");
+    high.push("h2");
+
+    // When: draining the selector
+    std::string order;
+    while (auto val = selector.try_pop()) {
+        order += val.value();
+    }
+
+    // Then: the high priority queue is served first
+    EXPECT_EQ(order, "h1h2l1l2");
+    EXPECT_TRUE(selector.is_empty());
+}
+
+/**
+ * @test WeightedServesByWeight
+ * @brief Ensures each busy queue receives its weight in elements per turn.
+ */
+TEST(ColaSelectorTest, WeightedServesByWeight) {
+    Cola<std::string> a(20);
+    Cola<std::string> b(20);
+    ColaSelector<std::string> selector(ColaSelector<std::string>::Policy::WEIGHTED);
+    selector.add(a, 3);
+    selector.add(b, 1);
+
+    // Given: both queues with a backlog
+    for (int i = 0; i < 12; i++) {
+        a.push("a");
+    }
+    for (int i = 0; i < 4; i++) {
+        b.push("b");
+    }
+    EXPECT_EQ(selector.get_size(), 16u);
+
+    // When: popping two rounds
+    std::string order;
+    for (int i = 0; i < 8; i++) {
+        auto val = selector.pop(std::chrono::seconds(1));
+        ASSERT_TRUE(val.has_value());
+        order += val.value();
+    }
+
+    // Then: "a" gets three elements for each one of "b"
+    EXPECT_EQ(order, "aaabaaab");
+}
+
+/**
+ * @test PopWakesOnAnyQueue
+ * @brief Ensures a blocked pop() returns as soon as the last added queue
+ *        receives data, instead of waiting for a per-queue timeout.
+ */
+TEST(ColaSelectorTest, PopWakesOnAnyQueue) {
+    Cola<int> first;
+    Cola<int> second;
+    Cola<int> third;
+    ColaSelector<int> selector;
+    selector.add(first);
+    selector.add(second);
+    selector.add(third);
+
+    // Given: a producer pushing into the last queue after a short delay
+    std::thread producer([&third] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        third.push(42);
+    });
+
+    // When: popping with a long timeout
+    const auto start = std::chrono::steady_clock::now();
+    auto val = selector.pop(std::chrono::seconds(5));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    producer.join();
+
+    // Then: the element arrives well before the timeout
+    ASSERT_TRUE(val.has_value());
+    EXPECT_EQ(val.value(), 42);
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+}
+
+/**
+ * @test QueueCallbacksMayUseSelector
+ * @brief Ensures a watermark callback fired by a selector pop can query the
+ *        selector, under both policies, instead of deadlocking on its lock.
+ */
+TEST(ColaSelectorTest, QueueCallbacksMayUseSelector) {
+    for (ColaSelector<int>::Policy policy :
+         {ColaSelector<int>::Policy::STRICT_PRIORITY, ColaSelector<int>::Policy::WEIGHTED}) {
+        Cola<int> cola(10);
+        ColaSelector<int> selector(policy);
+        selector.add(cola);
+        std::vector<size_t> sizes;
+        cola.set_watermarks(2, 1, [&](bool) { sizes.push_back(selector.get_size()); });
+
+        // Given: a queue above its high mark
+        cola.push(1);
+        cola.push(2);
+
+        // When: popping through the selector crosses the low mark
+        auto val = selector.try_pop();
+
+        // Then: the callback ran from inside the pop and saw the selector
+        ASSERT_TRUE(val.has_value());
+        EXPECT_EQ(val.value(), 1);
+        EXPECT_EQ(sizes, (std::vector<size_t>{2, 1}));
+    }
+}
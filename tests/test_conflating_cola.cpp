@@ -0,0 +1,122 @@
+/**
+ * @file        test_conflating_cola.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the ConflatingCola<K, V> class.
+ *
+ * @details
+ * These tests validate the behavior of `ConflatingCola`:
+ *  - Updates to a pending key replace its value and keep its position.
+ *  - Full queues evict the oldest pending key.
+ *  - A Worker consumes it like a Cola, once per key.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "conflating_cola.h"
+#include "recording_action.h"
+#include "worker.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+using Update = std::pair<std::string, int>;
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test ReplacesInPlace
+ * @brief Ensures a pending key keeps its position and only its latest value.
+ */
+TEST(ConflatingColaTest, ReplacesInPlace) {
+    ConflatingCola<std::string, int> cola(10);
+
+    // Given: updates for two keys, the first one updated twice more
+    cola.push("EURUSD", 1);
+    cola.push("GBPUSD", 10);
+    cola.push("EURUSD", 2);
+    cola.push("EURUSD", 3);
+
+    // When: draining the queue
+    auto first = cola.pop(std::chrono::seconds(1));
+    auto second = cola.pop(std::chrono::seconds(1));
+
+    // Then: each key is returned once, in arrival order, with its latest value
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first.value(), Update("EURUSD", 3));
+    EXPECT_EQ(second.value(), Update("GBPUSD", 10));
+    EXPECT_TRUE(cola.is_empty());
+
+    const ConflatingColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.pushed, 4u);
+    EXPECT_EQ(stats.conflated, 2u);
+    EXPECT_EQ(stats.popped, 2u);
+}
+
+/**
+ * @test EvictsOldestKey
+ * @brief Ensures a new key pushed into a full queue discards the oldest one,
+ *        while updates to pending keys never evict.
+ */
+TEST(ConflatingColaTest, EvictsOldestKey) {
+    ConflatingCola<int, int> cola(2);
+
+    // Given: a full queue
+    cola.push(1, 100);
+    cola.push(2, 200);
+
+    // When: updating a pending key, then adding a new one
+    cola.push(2, 201);
+    cola.push(3, 300);
+
+    // Then: only the oldest key was evicted
+    EXPECT_EQ(cola.get_stats().evicted, 1u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), std::make_pair(2, 201));
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), std::make_pair(3, 300));
+}
+
+/**
+ * @test WorkerConsumesOncePerKey
+ * @brief Ensures a Worker can consume a ConflatingCola and sees each key once.
+ */
+TEST(ConflatingColaTest, WorkerConsumesOncePerKey) {
+    ConflatingCola<std::string, int> cola(10);
+    RecordingAction<Update> action;
+
+    // Given: a burst of updates over two keys, queued before the worker starts
+    for (int i = 0; i < 50; i++) {
+        cola.push(i % 2 == 0 ? "a" : "b", i);
+    }
+
+    // When: a worker drains the queue
+    Worker<Update, ConflatingCola<std::string, int>> worker(cola, action, "W");
+    worker.start();
+    const auto processed = action.wait_for(2);
+
+    // Then: it did one unit of work per key, with the latest values
+    ASSERT_EQ(processed.size(), 2u);
+    EXPECT_EQ(processed[0], Update("a", 48));
+    EXPECT_EQ(processed[1], Update("b", 49));
+    EXPECT_EQ(cola.get_stats().conflated, 48u);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file        test_edf_cola.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the EdfCola<T> class.
+ *
+ * @details
+ * These tests validate the behavior of `EdfCola`:
+ *  - Elements are popped by nearest deadline, ties in push order.
+ *  - A full queue evicts late elements first, then the farthest deadline,
+ *    and rejects a new element with the farthest deadline.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+/* Project libraries */
+
+#include "edf_cola.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+using Clock = EdfCola<int>::Clock;
+
+Clock::time_point in_ms(int ms) { return Clock::now() + std::chrono::milliseconds(ms); }
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test PopsNearestDeadline
+ * @brief Ensures pop() follows deadline order over many random pushes.
+ */
+TEST(EdfColaTest, PopsNearestDeadline) {
+    EdfCola<int> cola(1000);
+    const Clock::time_point base = Clock::now() + std::chrono::hours(1);
+
+    // Given: elements pushed with shuffled deadlines
+    std::vector<int> offsets(1000);
+    for (int i = 0; i < 1000; i++) {
+        offsets[i] = i;
+    }
+    std::shuffle(offsets.begin(), offsets.end(), std::mt19937(42));
+    for (int offset : offsets) {
+        ASSERT_TRUE(cola.push(offset, base + std::chrono::milliseconds(offset)));
+    }
+
+    // When & Then: they come out sorted by deadline
+    for (int expected = 0; expected < 1000; expected++) {
+        auto val = cola.pop(std::chrono::seconds(1));
+        ASSERT_TRUE(val.has_value());
+        ASSERT_EQ(val.value(), expected);
+    }
+    EXPECT_TRUE(cola.is_empty());
+}
+
+/**
+ * @test TiesInPushOrder
+ * @brief Ensures elements sharing a deadline are popped FIFO.
+ */
+TEST(EdfColaTest, TiesInPushOrder) {
+    EdfCola<int> cola(10);
+    const Clock::time_point deadline = in_ms(10000);
+
+    for (int i = 0; i < 6; i++) {
+        cola.push(i, deadline);
+    }
+    for (int i = 0; i < 6; i++) {
+        EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), i);
+    }
+}
+
+/**
+ * @test EvictsFarthestOrRejects
+ * @brief Ensures a full queue makes room by dropping the farthest deadline,
+ *        or rejects the new element if its own deadline is the farthest.
+ */
+TEST(EdfColaTest, EvictsFarthestOrRejects) {
+    EdfCola<int> cola(3);
+
+    // Given: a full queue
+    cola.push(1, in_ms(1000));
+    cola.push(3, in_ms(3000));
+    cola.push(2, in_ms(2000));
+
+    // When: pushing a nearer and then a farther deadline
+    EXPECT_TRUE(cola.push(0, in_ms(500)));
+    EXPECT_FALSE(cola.push(9, in_ms(9000)));
+
+    // Then: the farthest element was evicted, the farthest push rejected
+    const EdfColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.evicted, 1u);
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 0);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 1);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 2);
+    EXPECT_TRUE(cola.is_empty());
+}
+
+/**
+ * @test EvictsMissedDeadlineFirst
+ * @brief Ensures an element already past its deadline is evicted before
+ *        any element that can still be on time.
+ */
+TEST(EdfColaTest, EvictsMissedDeadlineFirst) {
+    EdfCola<int> cola(2);
+
+    // Given: a full queue holding one late element
+    cola.push(1, in_ms(-10));
+    cola.push(2, in_ms(1000));
+
+    // When: pushing an element with the farthest deadline
+    EXPECT_TRUE(cola.push(3, in_ms(5000)));
+
+    // Then: the late element made room
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 2);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 3);
+    EXPECT_EQ(cola.get_stats().late, 0u);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file        test_event_count.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the EventCount class.
+ *
+ * @details
+ * These tests validate the behavior of `EventCount`:
+ *  - A notification issued after prepare_wait() is not lost.
+ *  - commit_wait() times out without a notification.
+ *  - A sleeping waiter is woken by another thread.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/* Project libraries */
+
+#include "event_count.h"
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test NotifyAfterPrepareIsNotLost
+ * @brief Ensures commit_wait() returns at once if notify() ran after prepare_wait().
+ */
+TEST(EventCountTest, NotifyAfterPrepareIsNotLost) {
+    EventCount ec;
+
+    // Given: a waiter registered before the notification
+    const EventCount::Key key = ec.prepare_wait();
+    ec.notify();
+
+    // When: committing with a long deadline
+    const auto start = std::chrono::steady_clock::now();
+    const bool notified = ec.commit_wait(key, start + std::chrono::seconds(5));
+
+    // Then: it does not sleep
+    EXPECT_TRUE(notified);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+/**
+ * @test CommitWaitTimesOut
+ * @brief Ensures commit_wait() reports a timeout when nobody notifies.
+ */
+TEST(EventCountTest, CommitWaitTimesOut) {
+    EventCount ec;
+
+    const EventCount::Key key = ec.prepare_wait();
+    const auto start = std::chrono::steady_clock::now();
+    const bool notified = ec.commit_wait(key, start + std::chrono::milliseconds(50));
+
+    EXPECT_FALSE(notified);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+}
+
+/**
+ * @test WakesSleepingWaiter
+ * @brief Ensures a waiter blocked in commit_wait() is woken by notify().
+ */
+TEST(EventCountTest, WakesSleepingWaiter) {
+    EventCount ec;
+    std::atomic<bool> ready(false);
+
+    // Given: a consumer waiting for the flag
+    std::thread consumer([&] {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!ready.load()) {
+            const EventCount::Key key = ec.prepare_wait();
+            if (ready.load()) {
+                ec.cancel_wait();
+                break;
+            }
+            ASSERT_TRUE(ec.commit_wait(key, until));
+        }
+    });
+
+    // When: the producer sets it after the consumer went to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ready.store(true);
+    ec.notify();
+
+    // Then: the consumer returns well before its deadline
+    consumer.join();
+    EXPECT_TRUE(ready.load());
+}
@@ -0,0 +1,143 @@
+/**
+ * @file        test_file_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the FileSink logger destination.
+ *
+ * @details
+ * These tests validate the behavior of `FileSink`:
+ *  - Records written through the sink reach the file after `flush()`.
+ *  - Size-based rotation shifts the active file to `path.1`.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/* Project libraries */
+
+#include "file_sink.h"
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream oss;
+    oss << in.rdbuf();
+    return oss.str();
+}
+
+void remove_logs(const std::string& path, size_t rotated) {
+    std::remove(path.c_str());
+    for (size_t i = 1; i <= rotated; ++i) {
+        std::remove((path + "." + std::to_string(i)).c_str());
+    }
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test WritesRecordsOnFlush
+ * @brief Ensures buffered records are persisted once flush() returns.
+ */
+TEST(FileSinkTest, WritesRecordsOnFlush) {
+    const std::string path = "test_file_sink_flush.log";
+    remove_logs(path, 0);
+
+    // Given: a sink with a large buffer
+    FileSink::Options options;
+    options.path = path;
+    FileSink sink(options);
+
+    // When: writing two records and flushing
+    sink.write("first\n", 6);
+    sink.write("second\n", 7);
+    sink.flush();
+
+    // Then: both records are in the file, in order
+    EXPECT_EQ(read_file(path), "first\nsecond\n");
+    EXPECT_EQ(sink.bytes_written(), 13u);
+    EXPECT_EQ(sink.bytes_dropped(), 0u);
+
+    remove_logs(path, 0);
+}
+
+/**
+ * @test RotatesBySize
+ * @brief Ensures the active file is rotated when it would exceed max_file_size.
+ *
+ * @details
+ * Uses a buffer smaller than a record so that every record is written
+ * individually and the rotation point is deterministic.
+ */
+TEST(FileSinkTest, RotatesBySize) {
+    const std::string path = "test_file_sink_rotate.log";
+    remove_logs(path, 2);
+
+    // Given: a sink limited to 10 bytes per file
+    FileSink::Options options;
+    options.path = path;
+    options.buffer_size = 1;
+    options.max_file_size = 10;
+    options.max_files = 2;
+    {
+        FileSink sink(options);
+
+        // When: writing more than one file worth of records
+        sink.write("aaaaaaaa\n", 9);
+        sink.write("bbbbbbbb\n", 9);
+        sink.flush();
+
+        // Then: the first record was rotated out of the active file
+        EXPECT_EQ(sink.rotations(), 1u);
+    }
+    EXPECT_EQ(read_file(path + ".1"), "aaaaaaaa\n");
+    EXPECT_EQ(read_file(path), "bbbbbbbb\n");
+
+    remove_logs(path, 2);
+}
+
+/**
+ * @test LoggerRedirectsToSink
+ * @brief Ensures Logger writes formatted records to a registered file sink.
+ */
+TEST(FileSinkTest, LoggerRedirectsToSink) {
+    const std::string path = "test_file_sink_logger.log";
+    remove_logs(path, 0);
+
+    // Given: a Logger with a file sink registered
+    FileSink::Options options;
+    options.path = path;
+    auto sink = std::make_shared<FileSink>(options);
+    Logger::add_sink(sink);
+
+    // When: logging a message
+    Logger::error("written to file");
+    sink->flush();
+    Logger::remove_sink(sink);
+
+    // Then: the formatted record is in the file
+    const std::string content = read_file(path);
+    EXPECT_NE(content.find("[ERROR] written to file\n"), std::string::npos);
+
+    sink.reset();
+    remove_logs(path, 0);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file        test_flight_recorder.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the FlightRecorder.
+ *
+ * @details
+ * These tests validate the behavior of `FlightRecorder`:
+ *  - DEBUG records filtered out by every sink are still captured and dumped.
+ *  - Records from several threads end up in the dump.
+ *  - Stopping the recorder restores the sink-only filtering.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/* Project libraries */
+
+#include "console_sink.h"
+#include "flight_recorder.h"
+#include "logger.h"
+#include "memory_sink.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream oss;
+    oss << in.rdbuf();
+    return oss.str();
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test CapturesFilteredDebugRecords
+ * @brief Ensures the recorder keeps records no sink accepts, from every thread.
+ */
+TEST(FlightRecorderTest, CapturesFilteredDebugRecords) {
+    if (!Logger::compiled_in(Logger::Level::DBG)) {
+        GTEST_SKIP() << "DEBUG stripped at compile time";
+    }
+    const std::string path = "test_flight_recorder.dump";
+
+    // Given: a sink accepting INFO and above, and a started recorder
+    Logger::clear_sinks();
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink, Logger::Level::INFO);
+    FlightRecorder::start(64);
+
+    // When: logging DEBUG records from two threads
+    LOG_DEBUG("main thread detail");
+    std::thread other([] { LOG_DEBUG("other thread detail"); });
+    other.join();
+    FlightRecorder::stop();
+
+    // Then: no sink received them, but the dump contains both
+    EXPECT_TRUE(sink->snapshot().empty());
+    ASSERT_TRUE(FlightRecorder::dump(path.c_str()));
+    const std::string content = read_file(path);
+    EXPECT_NE(content.find("[DEBUG] [T"), std::string::npos);
+    EXPECT_NE(content.find("main thread detail\n"), std::string::npos);
+    EXPECT_NE(content.find("other thread detail\n"), std::string::npos);
+
+    // And: once stopped, DEBUG is filtered again
+    EXPECT_FALSE(Logger::enabled(Logger::Level::DBG));
+
+    Logger::clear_sinks();
+    Logger::add_sink(std::make_shared<ConsoleSink>());
+    std::remove(path.c_str());
+}
@@ -0,0 +1,106 @@
+/**
+ * @file        test_log_stripping.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for compile-time log level stripping.
+ *
+ * @details
+ * This file is built as its own test binary with the compile-time level
+ * forced to WARN, as with `-DLOG_COMPILE_MIN_LEVEL=WARN`:
+ *  - LOG_DEBUG and LOG_INFO never evaluate their argument.
+ *  - They still compile with an argument Logger::log() does not accept.
+ *  - LOG_WARN and LOG_ERROR are unaffected.
+ *
+ * It must not share a binary with the other tests: the inline Logger
+ * functions would otherwise be defined with two different levels.
+ */
+
+/*****************************************************************************/
+
+/* Compile-time level */
+
+#undef LOGGER_COMPILE_MIN_LEVEL
+#define LOGGER_COMPILE_MIN_LEVEL 2
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+/* Project libraries */
+
+#include "console_sink.h"
+#include "logger.h"
+#include "memory_sink.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+/**
+ * @brief Type with no conversion to a message; only valid in a stripped statement.
+ */
+struct NotAMessage {
+    int value;
+};
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+static_assert(!Logger::compiled_in(Logger::Level::DBG), "DEBUG must be stripped");
+static_assert(!Logger::compiled_in(Logger::Level::INFO), "INFO must be stripped");
+static_assert(Logger::compiled_in(Logger::Level::WARN), "WARN must be compiled in");
+
+/**
+ * @test StrippedLevelsNeverEvaluate
+ * @brief Ensures stripped macros skip their argument even when a sink accepts
+ *        every level, while the compiled-in levels still log.
+ */
+TEST(LogStrippingTest, StrippedLevelsNeverEvaluate) {
+    // Given: a sink accepting every level
+    Logger::clear_sinks();
+    Logger::set_min_level(Logger::Level::DBG);
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink);
+    int evaluations = 0;
+
+    // When: logging side-effecting expressions at every level
+    LOG_DEBUG(std::to_string(++evaluations));
+    LOG_INFO(std::to_string(++evaluations));
+    LOG_DEBUG_LIMITED(1, std::chrono::seconds(1), std::to_string(++evaluations));
+    LOG_INFO_LIMITED(1, std::chrono::seconds(1), std::to_string(++evaluations));
+    LOG_WARN(std::to_string(++evaluations));
+    LOG_ERROR(std::to_string(++evaluations));
+
+    // Then: only the WARN and ERROR arguments ran, and only they were logged
+    EXPECT_EQ(evaluations, 2);
+    EXPECT_EQ(sink->snapshot().size(), 2u);
+
+    Logger::clear_sinks();
+    Logger::add_sink(std::make_shared<ConsoleSink>());
+    Logger::set_min_level(Logger::Level::INFO);
+}
+
+/**
+ * @test StrippedLevelsAcceptAnyExpression
+ * @brief Ensures a stripped statement compiles with an argument that is not a message.
+ */
+TEST(LogStrippingTest, StrippedLevelsAcceptAnyExpression) {
+    // When: passing a value Logger::log() has no overload for
+    LOG_DEBUG(NotAMessage{1});
+    LOG_INFO(NotAMessage{2});
+
+    // Then: it compiled, and nothing happened at run time
+    SUCCEED();
+}
@@ -0,0 +1,209 @@
+/**
+ * @file        test_logger.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the Logger sink fan-out.
+ *
+ * @details
+ * These tests validate the behavior of `Logger` with several sinks:
+ *  - Each sink only receives records at or above its own level.
+ *  - Records no sink accepts are reported as disabled.
+ *  - Call-site macros do not evaluate messages of disabled levels.
+ *  - Rate-limited call sites report how many records they suppressed,
+ *    also when they go quiet after a burst.
+ *
+ * `MemorySink` is used to capture the delivered records.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+/* Project libraries */
+
+#include "console_sink.h"
+#include "logger.h"
+#include "memory_sink.h"
+
+/*****************************************************************************/
+
+/* Fixtures */
+
+/**
+ * @brief Replaces the default console sink for the duration of a test.
+ */
+class LoggerSinkTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        Logger::clear_sinks();
+        Logger::set_min_level(Logger::Level::DBG);
+    }
+
+    void TearDown() override {
+        Logger::clear_sinks();
+        Logger::add_sink(std::make_shared<ConsoleSink>());
+        Logger::set_min_level(Logger::Level::INFO);
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test FansOutPerSinkLevel
+ * @brief Ensures a record reaches exactly the sinks whose level accepts it.
+ */
+TEST_F(LoggerSinkTest, FansOutPerSinkLevel) {
+    if (!Logger::compiled_in(Logger::Level::INFO)) {
+        GTEST_SKIP() << "INFO stripped at compile time";
+    }
+
+    // Given: a verbose sink and a warnings-only sink
+    auto verbose = std::make_shared<MemorySink>();
+    auto warnings = std::make_shared<MemorySink>();
+    Logger::add_sink(verbose, Logger::Level::DBG);
+    Logger::add_sink(warnings, Logger::Level::WARN);
+
+    // When: logging one INFO and one WARN record
+    Logger::info("info record");
+    Logger::warn("warn record");
+
+    // Then: the verbose sink got both, the warnings sink only the WARN one
+    const auto all = verbose->snapshot();
+    const auto warn_only = warnings->snapshot();
+    ASSERT_EQ(all.size(), 2u);
+    ASSERT_EQ(warn_only.size(), 1u);
+    EXPECT_NE(all[0].find("[INFO] info record\n"), std::string::npos);
+    EXPECT_NE(warn_only[0].find("[WARN] warn record\n"), std::string::npos);
+}
+
+/**
+ * @test DisabledWhenNoSinkAccepts
+ * @brief Ensures enabled() reflects the combined thresholds of every sink.
+ */
+TEST_F(LoggerSinkTest, DisabledWhenNoSinkAccepts) {
+    if (!Logger::compiled_in(Logger::Level::INFO)) {
+        GTEST_SKIP() << "INFO stripped at compile time";
+    }
+
+    // Given: a single sink accepting only errors
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink, Logger::Level::ERROR);
+
+    // When & Then: lower levels are disabled, errors are not
+    EXPECT_FALSE(Logger::enabled(Logger::Level::WARN));
+    EXPECT_TRUE(Logger::enabled(Logger::Level::ERROR));
+
+    // When: lowering the sink level
+    Logger::set_sink_level(sink, Logger::Level::INFO);
+
+    // Then: the threshold follows
+    EXPECT_TRUE(Logger::enabled(Logger::Level::INFO));
+
+    // When: removing the sink
+    Logger::remove_sink(sink);
+
+    // Then: nothing is enabled
+    EXPECT_FALSE(Logger::enabled(Logger::Level::ERROR));
+}
+
+/**
+ * @test MacrosSkipDisabledMessages
+ * @brief Ensures the LOG_* macros only evaluate the message when it is logged.
+ */
+TEST_F(LoggerSinkTest, MacrosSkipDisabledMessages) {
+    // Given: a sink accepting WARN and above
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink, Logger::Level::WARN);
+    int evaluations = 0;
+    auto message = [&evaluations] {
+        ++evaluations;
+        return std::string("message");
+    };
+
+    // When: logging through the macros at a disabled and an enabled level
+    LOG_INFO(message());
+    LOG_ERROR(message());
+
+    // Then: only the enabled statement built its message
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(sink->snapshot().size(), 1u);
+}
+
+/**
+ * @test RateLimitedSiteReportsSuppressed
+ * @brief Ensures a limited call site lets N records through per window and
+ *        reports the suppressed ones with the next accepted record.
+ */
+TEST_F(LoggerSinkTest, RateLimitedSiteReportsSuppressed) {
+    // Given: a sink capturing everything
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink);
+    auto emit = [] { LOG_ERROR_LIMITED(2, std::chrono::milliseconds(100), "repeated"); };
+
+    // When: the same site fires 5 times within one window
+    for (int i = 0; i < 5; ++i) {
+        emit();
+    }
+
+    // Then: only 2 records got through
+    EXPECT_EQ(sink->snapshot().size(), 2u);
+
+    // When: the site fires again in a later window
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    emit();
+
+    // Then: the new record carries the suppressed count
+    const auto records = sink->snapshot();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_NE(records[2].find("repeated (suppressed 3 similar messages)"), std::string::npos);
+}
+
+/**
+ * @test RateLimitedSiteFlushesWhenQuiet
+ * @brief Ensures the count of a site that bursts and goes quiet is reported
+ *        once its window ends, or at once by flush_suppressed(true).
+ */
+TEST_F(LoggerSinkTest, RateLimitedSiteFlushesWhenQuiet) {
+    // Given: a sink capturing everything and a limited site
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink);
+    auto emit = [] { LOG_ERROR_LIMITED(1, std::chrono::milliseconds(50), "burst"); };
+
+    // When: the site bursts, goes quiet past its window, and another record is logged
+    for (int i = 0; i < 5; ++i) {
+        emit();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    Logger::error("other");
+
+    // Then: the suppressed count was reported before that record
+    auto records = sink->snapshot();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_NE(records[1].find("[ERROR] "), std::string::npos);
+    EXPECT_NE(records[1].find("test_logger.cpp:"), std::string::npos);
+    EXPECT_NE(records[1].find(": suppressed 4 similar messages"), std::string::npos);
+    EXPECT_NE(records[2].find("other"), std::string::npos);
+
+    // When: the site bursts again and the program shuts down within the window
+    emit();
+    emit();
+    emit();
+    Logger::flush_suppressed(true);
+
+    // Then: the pending count is reported without waiting, and only once
+    Logger::flush_suppressed(true);
+    records = sink->snapshot();
+    ASSERT_EQ(records.size(), 5u);
+    EXPECT_NE(records[4].find(": suppressed 2 similar messages"), std::string::npos);
+}
@@ -11,6 +11,13 @@
  *  - Capacity limit and element eviction when the buffer is full.
  *  - FIFO order of extraction.
  *  - Timeout handling when attempting to pop from an empty queue.
+ *  - Statistics and CoDel sojourn-time drops.
+ *  - Deadline / TTL expiry.
+ *  - Adaptive LIFO ordering.
+ *  - Bulk transfers and pop into an out-parameter.
+ *  - Run-time and elastic capacity.
+ *  - Byte budget eviction and try_push() backpressure.
+ *  - High/low watermarks, including callbacks that use the queue.
  *
  * The tests use GoogleTest and rely on `nonstd::optional` to
  * represent the presence or absence of values.
@@ -24,6 +31,8 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <string>
+#include <thread>
 #include <vector>
 
 /* Third party libraries */
@@ -124,4 +133,474 @@ TEST(ColaTest, PopReturnsTimeout) {
 
     // Then: the call must return an empty optional
     EXPECT_EQ(extracted_value, nonstd::nullopt);
-}
\ No newline at end of file
+}
+
+/**
+ * @test StatsCountEvictions
+ * @brief Ensures get_stats() reports pushes, pops and drop-oldest evictions.
+ */
+TEST(ColaTest, StatsCountEvictions) {
+    Cola<int> cola(3);
+
+    // Given: five pushes into a queue of three
+    for (int i = 0; i < 5; i++) {
+        cola.push(i);
+    }
+
+    // When: popping one element
+    ASSERT_TRUE(cola.pop(std::chrono::seconds(1)).has_value());
+
+    // Then: the counters reflect every operation
+    const ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_EQ(stats.pushed, 5u);
+    EXPECT_EQ(stats.popped, 1u);
+    EXPECT_EQ(stats.evicted, 2u);
+    EXPECT_EQ(stats.codel_dropped, 0u);
+}
+
+/**
+ * @test CodelLetsBurstsThrough
+ * @brief Ensures a burst drained within the CoDel interval loses nothing.
+ */
+TEST(ColaTest, CodelLetsBurstsThrough) {
+    Cola<int> cola(100);
+    cola.set_codel(std::chrono::milliseconds(50), std::chrono::milliseconds(500));
+
+    // Given: a burst of 20 elements
+    for (int i = 0; i < 20; i++) {
+        cola.push(i);
+    }
+
+    // When: draining it right away
+    // Then: every element is delivered in order
+    for (int i = 0; i < 20; i++) {
+        auto val = cola.pop(std::chrono::seconds(1));
+        ASSERT_TRUE(val.has_value());
+        EXPECT_EQ(val.value(), i);
+    }
+    EXPECT_EQ(cola.get_stats().codel_dropped, 0u);
+}
+
+/**
+ * @test CodelDropsStandingQueue
+ * @brief Ensures elements are dropped once the sojourn stays above target
+ *        for a whole interval, and that the last element is kept.
+ */
+TEST(ColaTest, CodelDropsStandingQueue) {
+    Cola<int> cola(100);
+    cola.set_codel(std::chrono::milliseconds(1), std::chrono::milliseconds(20));
+
+    // Given: a standing queue older than the target
+    for (int i = 0; i < 10; i++) {
+        cola.push(i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // When: the first pop starts the interval and a later one ends it
+    auto first = cola.pop(std::chrono::seconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    auto second = cola.pop(std::chrono::seconds(1));
+
+    // Then: the first pop is served, the second skips dropped elements
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first.value(), 0);
+    const ColaStats stats = cola.get_stats();
+    EXPECT_GE(stats.codel_dropped, 1u);
+    EXPECT_EQ(second.value(), static_cast<int>(1 + stats.codel_dropped));
+    EXPECT_EQ(stats.size, 10u - 2u - stats.codel_dropped);
+
+    // And: draining never drops the last element
+    while (cola.get_size() > 0) {
+        ASSERT_TRUE(cola.pop(std::chrono::seconds(1)).has_value());
+    }
+}
+
+/**
+ * @test TtlSkipsExpiredOnPop
+ * @brief Ensures elements older than the TTL are handed to the expiry
+ *        callback instead of being popped.
+ */
+TEST(ColaTest, TtlSkipsExpiredOnPop) {
+    Cola<int> cola(10);
+    std::vector<int> expired;
+    cola.set_expiry_callback([&expired](int&& dato) { expired.push_back(dato); });
+    cola.set_ttl(std::chrono::milliseconds(20));
+
+    // Given: two elements that outlive the TTL and a fresh one
+    cola.push(1);
+    cola.push(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    cola.push(3);
+
+    // When: popping
+    auto val = cola.pop(std::chrono::seconds(1));
+
+    // Then: only the fresh element is returned, the others are reported
+    ASSERT_TRUE(val.has_value());
+    EXPECT_EQ(val.value(), 3);
+    EXPECT_EQ(expired, (std::vector<int>{1, 2}));
+    EXPECT_EQ(cola.get_stats().expired, 2u);
+}
+
+/**
+ * @test ExpiredPurgedBeforeEviction
+ * @brief Ensures a push into a full queue discards expired elements
+ *        before evicting live ones.
+ */
+TEST(ColaTest, ExpiredPurgedBeforeEviction) {
+    Cola<int> cola(2);
+    const auto now = Cola<int>::Clock::now();
+
+    // Given: a full queue whose second element is already expired
+    cola.push(1, now + std::chrono::hours(1));
+    cola.push(2, now - std::chrono::milliseconds(1));
+
+    // When: pushing one more element
+    cola.push(3);
+
+    // Then: the expired element made room, nothing live was evicted
+    const ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.expired, 1u);
+    EXPECT_EQ(stats.evicted, 0u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 1);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 3);
+}
+
+/**
+ * @test AdaptiveLifoServesNewestWhenDeep
+ * @brief Ensures the queue serves LIFO past the depth threshold and
+ *        returns to FIFO once drained.
+ */
+TEST(ColaTest, AdaptiveLifoServesNewestWhenDeep) {
+    Cola<int> cola(100);
+    cola.set_adaptive_lifo(5);
+
+    // Given: a shallow queue, served FIFO
+    for (int i = 0; i < 3; i++) {
+        cola.push(i);
+    }
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 0);
+
+    // When: the queue grows past the threshold
+    for (int i = 3; i < 10; i++) {
+        cola.push(i);
+    }
+
+    // Then: the newest elements are served first until it is drained
+    for (int expected = 9; expected >= 1; expected--) {
+        auto val = cola.pop(std::chrono::seconds(1));
+        ASSERT_TRUE(val.has_value());
+        EXPECT_EQ(val.value(), expected);
+    }
+
+    // And: FIFO resumes afterwards
+    cola.push(20);
+    cola.push(21);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(1)).value(), 20);
+
+    const ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.lifo_switches, 1u);
+    EXPECT_GT(stats.lifo_time.count(), 0);
+    EXPECT_GT(stats.fifo_time.count(), 0);
+}
+
+/**
+ * @test BulkTransfersWrapAround
+ * @brief Ensures bulk push and pop keep FIFO order across the end of the ring.
+ */
+TEST(ColaTest, BulkTransfersWrapAround) {
+    Cola<int> cola(100);
+
+    // Given: a ring whose head is near the end of its first 16 slots
+    const std::vector<int> first = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    cola.push_bulk(first.data(), first.size());
+    int discard[10];
+    ASSERT_EQ(cola.pop_bulk(discard, 10, std::chrono::seconds(1)), 10u);
+
+    // When: pushing a batch that wraps around, then draining in one call
+    const std::vector<int> second = {13, 14, 15, 16, 17, 18, 19, 20};
+    cola.push_bulk(second.data(), second.size());
+    int out[32];
+    const size_t taken = cola.pop_bulk(out, 32, std::chrono::seconds(1));
+
+    // Then: everything comes out in push order
+    ASSERT_EQ(taken, 11u);
+    for (size_t i = 0; i < taken; i++) {
+        EXPECT_EQ(out[i], static_cast<int>(i) + 10);
+    }
+    EXPECT_TRUE(cola.is_empty());
+    EXPECT_EQ(cola.get_stats().popped, 21u);
+}
+
+/**
+ * @test BulkPushEvictsOldest
+ * @brief Ensures a bulk push into a full queue keeps the newest elements,
+ *        as repeated push() calls would.
+ */
+TEST(ColaTest, BulkPushEvictsOldest) {
+    Cola<std::string> cola(3);
+    cola.push("a");
+
+    // When: pushing more elements than fit
+    const std::string batch[] = {"b", "c", "d", "e"};
+    cola.push_bulk(batch, 4);
+
+    // Then: only the three newest remain
+    std::string out[3];
+    ASSERT_EQ(cola.pop_bulk(out, 3, std::chrono::seconds(1)), 3u);
+    EXPECT_EQ(out[0], "c");
+    EXPECT_EQ(out[1], "d");
+    EXPECT_EQ(out[2], "e");
+    const ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.pushed, 5u);
+    EXPECT_EQ(stats.evicted, 2u);
+}
+
+/**
+ * @test PopIntoOutParameter
+ * @brief Ensures pop_into() returns elements through its argument and
+ *        leaves it untouched on timeout.
+ */
+TEST(ColaTest, PopIntoOutParameter) {
+    Cola<int> cola;
+    cola.push(42);
+
+    int out = 0;
+    EXPECT_TRUE(cola.pop_into(out, std::chrono::seconds(1)));
+    EXPECT_EQ(out, 42);
+
+    out = -1;
+    EXPECT_FALSE(cola.pop_into(out, std::chrono::seconds(0)));
+    EXPECT_EQ(out, -1);
+}
+
+/**
+ * @test SetCapacityEvictsOldest
+ * @brief Ensures lowering the capacity evicts the oldest elements and
+ *        raising it lets more elements in.
+ */
+TEST(ColaTest, SetCapacityEvictsOldest) {
+    Cola<int> cola(4);
+    for (int i = 0; i < 4; i++) {
+        cola.push(i);
+    }
+
+    // When: shrinking below the current size
+    cola.set_capacity(2);
+
+    // Then: the two newest remain
+    EXPECT_EQ(cola.get_capacity(), 2u);
+    EXPECT_EQ(cola.get_size(), 2u);
+    EXPECT_EQ(cola.get_stats().evicted, 2u);
+
+    // When: growing again
+    cola.set_capacity(5);
+    for (int i = 4; i < 7; i++) {
+        cola.push(i);
+    }
+
+    // Then: nothing else is evicted
+    int out[5];
+    ASSERT_EQ(cola.pop_bulk(out, 5, std::chrono::seconds(0)), 5u);
+    EXPECT_EQ(out[0], 2);
+    EXPECT_EQ(out[4], 6);
+    EXPECT_EQ(cola.get_stats().evicted, 2u);
+}
+
+/**
+ * @test ElasticCapacityFollowsLoad
+ * @brief Ensures the elastic policy grows instead of evicting, up to its
+ *        upper bound, and shrinks back after a window of low occupancy.
+ */
+TEST(ColaTest, ElasticCapacityFollowsLoad) {
+    Cola<std::string> cola(4);
+    cola.set_elastic_capacity(4, 16);
+
+    // When: a burst larger than the capacity
+    for (int i = 0; i < 20; i++) {
+        cola.push(std::to_string(i));
+    }
+
+    // Then: the capacity doubled up to the bound; only the overflow was evicted
+    ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.capacity, 16u);
+    EXPECT_EQ(stats.capacity_grows, 2u);
+    EXPECT_EQ(stats.evicted, 4u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "4");
+
+    // When: the burst drains and the load stays at one element at a time
+    while (cola.try_pop()) {
+    }
+    for (int i = 0; i < 32; i++) {
+        cola.push("x");
+        cola.pop(std::chrono::seconds(0));
+    }
+
+    // Then: the capacity went back down to the lower bound
+    stats = cola.get_stats();
+    EXPECT_EQ(stats.capacity, 4u);
+    EXPECT_EQ(stats.capacity_shrinks, 2u);
+}
+
+/**
+ * @test ByteBudgetEvictsBySize
+ * @brief Ensures a byte budget evicts the oldest elements until a new one
+ *        fits, refuses elements larger than the budget and reports bytes.
+ */
+TEST(ColaTest, ByteBudgetEvictsBySize) {
+    Cola<std::string> cola(100);
+    cola.set_byte_budget(10, [](const std::string& s) { return s.size(); });
+
+    // Given: 9 bytes queued
+    cola.push("aaa");
+    cola.push("bbb");
+    cola.push("ccc");
+    EXPECT_EQ(cola.get_stats().bytes, 9u);
+
+    // When: pushing 5 more bytes
+    cola.push("ddddd");
+
+    // Then: the two oldest were evicted to make room
+    ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_EQ(stats.bytes, 8u);
+    EXPECT_EQ(stats.evicted, 2u);
+
+    // When: pushing an element larger than the whole budget
+    cola.push("eeeeeeeeeee");
+
+    // Then: it is rejected and the queue is untouched
+    stats = cola.get_stats();
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "ccc");
+    EXPECT_EQ(cola.get_stats().bytes, 5u);
+}
+
+/**
+ * @test TryPushAppliesBackpressure
+ * @brief Ensures try_push() refuses elements that do not fit instead of
+ *        evicting, and leaves them with the caller.
+ */
+TEST(ColaTest, TryPushAppliesBackpressure) {
+    Cola<std::string> cola(100);
+    cola.set_byte_budget(6, [](const std::string& s) { return s.size(); });
+    std::string first = "aaaa";
+    std::string second = "bbbb";
+
+    // When: the second element would exceed the budget
+    EXPECT_TRUE(cola.try_push(std::move(first)));
+    EXPECT_FALSE(cola.try_push(std::move(second)));
+
+    // Then: it is refused and still held by the caller
+    EXPECT_EQ(second, "bbbb");
+    ColaStats stats = cola.get_stats();
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.evicted, 0u);
+
+    // When: the consumer frees room
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), "aaaa");
+
+    // Then: the retry succeeds
+    EXPECT_TRUE(cola.try_push(std::move(second)));
+    EXPECT_EQ(cola.get_stats().bytes, 4u);
+}
+
+/**
+ * @test WatermarksFireWithHysteresis
+ * @brief Ensures the watermark state turns high at the high mark, stays
+ *        high until the low mark and is reported once per change.
+ */
+TEST(ColaTest, WatermarksFireWithHysteresis) {
+    Cola<int> cola(10);
+    std::vector<bool> reported;
+    cola.set_watermarks(4, 1, [&reported](bool above_high) { reported.push_back(above_high); });
+
+    // When: filling up to the high mark
+    for (int i = 0; i < 4; i++) {
+        EXPECT_FALSE(cola.is_above_high_watermark());
+        cola.push(i);
+    }
+
+    // Then: the state is high, reported once
+    EXPECT_TRUE(cola.is_above_high_watermark());
+    EXPECT_EQ(reported, (std::vector<bool>{true}));
+
+    // When: draining between the marks
+    cola.pop(std::chrono::seconds(0));
+    cola.pop(std::chrono::seconds(0));
+    cola.push(4);
+
+    // Then: it stays high
+    EXPECT_TRUE(cola.is_above_high_watermark());
+    EXPECT_EQ(reported.size(), 1u);
+
+    // When: draining down to the low mark
+    cola.pop(std::chrono::seconds(0));
+    cola.pop(std::chrono::seconds(0));
+
+    // Then: the state is low again, reported once
+    EXPECT_FALSE(cola.is_above_high_watermark());
+    EXPECT_EQ(reported, (std::vector<bool>{true, false}));
+}
+
+/**
+ * @test WatermarkCallbackMayUseQueue
+ * @brief Ensures the callback may drain the queue past the other mark: the
+ *        nested change is delivered after the call returns, not re-entered.
+ */
+TEST(ColaTest, WatermarkCallbackMayUseQueue) {
+    Cola<int> cola(10);
+    std::vector<bool> reported;
+    bool in_callback = false;
+    bool nested = false;
+    cola.set_watermarks(3, 1, [&](bool above_high) {
+        nested = nested || in_callback;
+        in_callback = true;
+        reported.push_back(above_high);
+        // Given: a callback draining the queue down to the low mark
+        while (above_high && cola.get_size() > 1) {
+            cola.pop(std::chrono::seconds(0));
+        }
+        in_callback = false;
+    });
+
+    // When: a push reaches the high mark
+    for (int i = 0; i < 3; i++) {
+        cola.push(i);
+    }
+
+    // Then: both changes were reported in order, one call at a time
+    EXPECT_FALSE(nested);
+    EXPECT_EQ(reported, (std::vector<bool>{true, false}));
+    EXPECT_FALSE(cola.is_above_high_watermark());
+    EXPECT_EQ(cola.get_size(), 1u);
+}
+
+/**
+ * @test WatermarksUseBytesWithBudget
+ * @brief Ensures the watermark level is measured in bytes under a byte budget.
+ */
+TEST(ColaTest, WatermarksUseBytesWithBudget) {
+    Cola<std::string> cola(100);
+    cola.set_byte_budget(1000, [](const std::string& s) { return s.size(); });
+    cola.set_watermarks(100, 10);
+
+    // When: two elements reaching 100 bytes
+    cola.push(std::string(60, 'a'));
+    EXPECT_FALSE(cola.is_above_high_watermark());
+    cola.push(std::string(40, 'b'));
+
+    // Then: the state is high
+    EXPECT_TRUE(cola.is_above_high_watermark());
+
+    // When: only the 40 bytes element is left
+    cola.pop(std::chrono::seconds(0));
+
+    // Then: still above the low mark
+    EXPECT_TRUE(cola.is_above_high_watermark());
+    cola.pop(std::chrono::seconds(0));
+    EXPECT_FALSE(cola.is_above_high_watermark());
+}
@@ -0,0 +1,144 @@
+/**
+ * @file        test_mmap_file_sink.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the MmapFileSink logger destination.
+ *
+ * @details
+ * These tests validate the behavior of `MmapFileSink`:
+ *  - Concurrent writers never lose or tear records across rotations.
+ *  - In EXTEND mode every record stays in a single growing file.
+ */
+
+/*****************************************************************************/
+
+#if !defined(_WIN32)
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "mmap_file_sink.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+constexpr int THREADS = 4;
+constexpr int RECORDS_PER_THREAD = 2000;
+const std::string RECORD = "0123456789012345678901234567890123456789\n";
+
+/**
+ * @brief Count complete records in a file, ignoring EXTEND padding lines.
+ * @return Number of lines equal to RECORD; -1 if any other non-blank line is found.
+ */
+int count_records(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    int count = 0;
+    while (std::getline(in, line)) {
+        if (line + "\n" == RECORD) {
+            ++count;
+        } else if (line.find_first_not_of(' ') != std::string::npos) {
+            return -1;
+        }
+    }
+    return count;
+}
+
+void write_concurrently(MmapFileSink& sink) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&sink] {
+            for (int i = 0; i < RECORDS_PER_THREAD; ++i) {
+                sink.write(RECORD.data(), RECORD.size());
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test RotatesWithoutLosingRecords
+ * @brief Ensures every record written concurrently ends up, intact, in one of the files.
+ */
+TEST(MmapFileSinkTest, RotatesWithoutLosingRecords) {
+    const std::string path = "test_mmap_sink_rotate.log";
+    constexpr size_t MAX_FILES = 200;
+    for (size_t i = 0; i <= MAX_FILES; ++i) {
+        std::remove((i == 0 ? path : path + "." + std::to_string(i)).c_str());
+    }
+
+    // Given: a sink with small regions, forcing many rotations
+    MmapFileSink::Options options;
+    options.path = path;
+    options.region_size = 4096;
+    options.max_files = MAX_FILES;
+    uint64_t rollovers = 0;
+    {
+        MmapFileSink sink(options);
+
+        // When: several threads write concurrently
+        write_concurrently(sink);
+        rollovers = sink.rollovers();
+    }
+
+    // Then: the files hold exactly all the records
+    int total = 0;
+    for (size_t i = 0; i <= MAX_FILES; ++i) {
+        const std::string file = i == 0 ? path : path + "." + std::to_string(i);
+        const int count = count_records(file);
+        ASSERT_GE(count, 0) << "corrupted record in " << file;
+        total += count;
+        std::remove(file.c_str());
+    }
+    EXPECT_GT(rollovers, 0u);
+    EXPECT_EQ(total, THREADS * RECORDS_PER_THREAD);
+}
+
+/**
+ * @test ExtendsSingleFile
+ * @brief Ensures EXTEND mode keeps every record in the same file.
+ */
+TEST(MmapFileSinkTest, ExtendsSingleFile) {
+    const std::string path = "test_mmap_sink_extend.log";
+    std::remove(path.c_str());
+
+    // Given: a sink with small regions in EXTEND mode
+    MmapFileSink::Options options;
+    options.path = path;
+    options.region_size = 4096;
+    options.when_full = MmapFileSink::FullPolicy::EXTEND;
+    {
+        MmapFileSink sink(options);
+
+        // When: several threads write concurrently
+        write_concurrently(sink);
+    }
+
+    // Then: the single file holds every record
+    EXPECT_EQ(count_records(path), THREADS * RECORDS_PER_THREAD);
+    std::remove(path.c_str());
+}
+
+#endif  // !defined(_WIN32)
@@ -0,0 +1,144 @@
+/**
+ * @file        test_mpsc_cola.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the IntrusiveMpscQueue<T> and MpscCola<T> classes.
+ *
+ * @details
+ * These tests validate the behavior of the intrusive MPSC queue:
+ *  - Nodes come out in push order, including a node pushed again after its pop.
+ *  - Concurrent producers lose no node and keep their own order.
+ *  - A Worker can consume an MpscCola.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "mpsc_cola.h"
+#include "recording_action.h"
+#include "worker.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+/**
+ * @brief User node carrying the queue link.
+ */
+struct Message : MpscNode {
+    int producer = 0;
+    int seq = 0;
+};
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test FifoOrder
+ * @brief Ensures nodes are popped in push order and can be reused once popped.
+ */
+TEST(MpscColaTest, FifoOrder) {
+    IntrusiveMpscQueue<Message> queue;
+    Message nodes[3];
+    for (int i = 0; i < 3; i++) {
+        nodes[i].seq = i;
+    }
+    EXPECT_TRUE(queue.is_empty());
+    EXPECT_EQ(queue.try_pop(), nullptr);
+
+    // Given: three nodes, the first one reused after being popped
+    queue.push(&nodes[0]);
+    queue.push(&nodes[1]);
+    ASSERT_EQ(queue.try_pop(), &nodes[0]);
+    queue.push(&nodes[2]);
+    queue.push(&nodes[0]);
+
+    // Then: the rest come out in push order
+    EXPECT_EQ(queue.try_pop(), &nodes[1]);
+    EXPECT_EQ(queue.try_pop(), &nodes[2]);
+    EXPECT_EQ(queue.try_pop(), &nodes[0]);
+    EXPECT_EQ(queue.try_pop(), nullptr);
+    EXPECT_TRUE(queue.is_empty());
+}
+
+/**
+ * @test ConcurrentProducers
+ * @brief Ensures nodes from several producers all arrive, each producer in order.
+ */
+TEST(MpscColaTest, ConcurrentProducers) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 10000;
+    MpscCola<Message> cola;
+    std::vector<Message> nodes(PRODUCERS * PER_PRODUCER);
+
+    // Given: producers pushing concurrently
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&cola, &nodes, p] {
+            for (int i = 0; i < PER_PRODUCER; i++) {
+                Message& node = nodes[p * PER_PRODUCER + i];
+                node.producer = p;
+                node.seq = i;
+                cola.push(&node);
+            }
+        });
+    }
+
+    // When: a single consumer drains them
+    std::vector<int> next(PRODUCERS, 0);
+    for (int received = 0; received < PRODUCERS * PER_PRODUCER; received++) {
+        auto node = cola.pop(std::chrono::seconds(5));
+        ASSERT_TRUE(node.has_value());
+        Message* msg = node.value();
+
+        // Then: each producer's nodes arrive in order
+        ASSERT_EQ(msg->seq, next[msg->producer]);
+        next[msg->producer]++;
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(cola.is_empty());
+}
+
+/**
+ * @test WorkerConsumesNodes
+ * @brief Ensures a Worker can consume an MpscCola.
+ */
+TEST(MpscColaTest, WorkerConsumesNodes) {
+    MpscCola<Message> cola;
+    RecordingAction<Message*, int> action([](Message* const& dato) { return dato->seq; });
+    Message nodes[3];
+    for (int i = 0; i < 3; i++) {
+        nodes[i].seq = i;
+    }
+
+    // Given: a running worker
+    Worker<Message*, MpscCola<Message>> worker(cola, action, "W");
+    worker.start();
+
+    // When: pushing nodes
+    for (Message& node : nodes) {
+        cola.push(&node);
+    }
+
+    // Then: the worker processes them in order
+    const auto processed = action.wait_for(3);
+    EXPECT_EQ(processed, (std::vector<int>{0, 1, 2}));
+}
@@ -0,0 +1,198 @@
+/**
+ * @file        test_spsc_cola.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the SpscCola<T> class and the consume() API.
+ *
+ * @details
+ * These tests validate the behavior of the SPSC ring queue:
+ *  - Elements come out in push order and push fails once the ring is full.
+ *  - consume() runs on the element in place, without moving it.
+ *  - A producer and a consumer thread transfer every element in order.
+ *  - A Worker consumes through consume(), and Cola::consume() moves once.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+#include "recording_action.h"
+#include "spsc_cola.h"
+#include "worker.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+/**
+ * @brief Value counting how many times it has been moved (copies are disabled).
+ */
+struct Counted {
+    int value = 0;
+    int moves = 0;
+
+    explicit Counted(int value) : value(value) {}
+    Counted(const Counted&) = delete;
+    Counted(Counted&& other) : value(other.value), moves(other.moves + 1) {}
+    Counted& operator=(const Counted&) = delete;
+    Counted& operator=(Counted&& other) {
+        value = other.value;
+        moves = other.moves + 1;
+        return *this;
+    }
+};
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test FifoAndFull
+ * @brief Ensures push order is kept and push is rejected while the ring is full.
+ */
+TEST(SpscColaTest, FifoAndFull) {
+    SpscCola<int> cola(3);
+    EXPECT_TRUE(cola.is_empty());
+
+    // Given: a full queue
+    EXPECT_TRUE(cola.push(1));
+    EXPECT_TRUE(cola.push(2));
+    EXPECT_TRUE(cola.push(3));
+
+    // When: pushing once more
+    // Then: the new element is rejected
+    EXPECT_FALSE(cola.push(4));
+    EXPECT_EQ(cola.get_size(), 3u);
+
+    // When: popping frees a slot
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), 1);
+    EXPECT_TRUE(cola.push(5));
+
+    // Then: the rest come out in push order, then the queue times out empty
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), 2);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), 3);
+    EXPECT_EQ(cola.pop(std::chrono::seconds(0)).value(), 5);
+    EXPECT_FALSE(cola.pop(std::chrono::seconds(0)).has_value());
+    EXPECT_TRUE(cola.is_empty());
+}
+
+/**
+ * @test ConsumeInPlace
+ * @brief Ensures consume() hands out the element in its slot, without a move.
+ */
+TEST(SpscColaTest, ConsumeInPlace) {
+    SpscCola<Counted> cola(4);
+
+    // Given: an element moved once into the queue
+    ASSERT_TRUE(cola.push(Counted(7)));
+
+    // When: consuming it
+    int value = 0;
+    int moves = -1;
+    const bool consumed = cola.consume(
+        [&](Counted& dato) {
+            value = dato.value;
+            moves = dato.moves;
+        },
+        std::chrono::seconds(0));
+
+    // Then: fn saw it with no move beyond the push, and the slot was released
+    EXPECT_TRUE(consumed);
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(moves, 1);
+    EXPECT_TRUE(cola.is_empty());
+    EXPECT_FALSE(cola.consume([](Counted&) { FAIL(); }, std::chrono::seconds(0)));
+}
+
+/**
+ * @test ConcurrentTransfer
+ * @brief Ensures a producer and a consumer thread transfer every element in order.
+ */
+TEST(SpscColaTest, ConcurrentTransfer) {
+    constexpr int ITEMS = 100000;
+    SpscCola<int> cola(64);
+
+    // Given: a producer retrying while the ring is full
+    std::thread producer([&cola] {
+        for (int i = 0; i < ITEMS; i++) {
+            while (!cola.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // When: the consumer drains it
+    // Then: every element arrives once, in order
+    for (int expected = 0; expected < ITEMS; expected++) {
+        int received = -1;
+        ASSERT_TRUE(cola.consume([&](int& dato) { received = dato; }, std::chrono::seconds(5)));
+        ASSERT_EQ(received, expected);
+    }
+    producer.join();
+    EXPECT_TRUE(cola.is_empty());
+}
+
+/**
+ * @test WorkerConsumesInPlace
+ * @brief Ensures a Worker over an SpscCola processes elements in their slot.
+ */
+TEST(SpscColaTest, WorkerConsumesInPlace) {
+    SpscCola<Counted> cola(8);
+    RecordingAction<Counted, std::pair<int, int>> action(
+        [](const Counted& dato) { return std::make_pair(dato.value, dato.moves); });
+
+    // Given: a running worker
+    Worker<Counted, SpscCola<Counted>> worker(cola, action, "W");
+    worker.start();
+
+    // When: pushing elements
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(cola.push(Counted(i)));
+    }
+
+    // Then: they are processed in order, with only the moves of the push
+    const auto processed = action.wait_for(3);
+    EXPECT_EQ(processed, (std::vector<std::pair<int, int>>{{0, 1}, {1, 1}, {2, 1}}));
+}
+
+/**
+ * @test ColaConsumeMovesOnce
+ * @brief Ensures Cola::consume() moves the element out of the buffer exactly once.
+ */
+TEST(SpscColaTest, ColaConsumeMovesOnce) {
+    Cola<Counted> cola(4);
+
+    // Given: an element moved once into the buffer
+    cola.push(Counted(9));
+
+    // When: consuming it
+    int value = 0;
+    int moves = -1;
+    EXPECT_TRUE(cola.consume(
+        [&](Counted& dato) {
+            value = dato.value;
+            moves = dato.moves;
+        },
+        std::chrono::seconds(0)));
+
+    // Then: fn received the element after a single move out of the buffer
+    EXPECT_EQ(value, 9);
+    EXPECT_EQ(moves, 2);
+    EXPECT_TRUE(cola.is_empty());
+}
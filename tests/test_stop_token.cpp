@@ -0,0 +1,298 @@
+/**
+ * @file        test_stop_token.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the StopSource/StopToken classes and Worker cancellation.
+ *
+ * @details
+ * These tests validate cooperative cancellation:
+ *  - Callbacks run once on the stop request, or at once when added late.
+ *  - A removed callback does not run, and reset() makes the source reusable.
+ *  - Worker::stop(deadline) interrupts a token-aware action and reports
+ *    the abandoned element, and reports failure when the action ignores it.
+ *  - An element completed while a stop is pending is not reported.
+ *  - A Worker stopped with a deadline can be started again.
+ *  - An element taken from the queue after stop(deadline) returned is
+ *    reported as abandoned without being started.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cola.h"
+#include "i_worker_action.h"
+#include "stop_token.h"
+#include "worker.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+/**
+ * @brief Action that works on each element for up to `work` unless stopped,
+ *        optionally polling the stop token.
+ */
+class SlowAction : public IWorkerAction<int> {
+   public:
+    SlowAction(std::chrono::milliseconds work, bool polls) : work(work), polls(polls) {}
+
+    void trabajo(const std::string&, const int&) override {
+        started = true;
+        std::this_thread::sleep_for(work);
+    }
+
+    bool trabajo_cancelable(const std::string& name, const int& dato,
+                            StopToken stop) override {
+        if (!polls) {
+            trabajo(name, dato);
+            return true;
+        }
+        started = true;
+        const auto until = std::chrono::steady_clock::now() + work;
+        while (std::chrono::steady_clock::now() < until) {
+            if (stop.stop_requested()) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    void colaVacia(const std::string&, const std::chrono::seconds) override {}
+
+    void onStop(const std::string&) override {}
+
+    void onAbandoned(const std::string&, const int& dato) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        abandoned.push_back(dato);
+    }
+
+    std::vector<int> get_abandoned() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return abandoned;
+    }
+
+    std::atomic<bool> started{false};
+
+   private:
+    std::chrono::milliseconds work;
+    bool polls;
+    std::mutex mtx;
+    std::vector<int> abandoned;
+};
+
+/**
+ * @brief Queue whose pop() holds on to the element it took until released,
+ *        to stop the worker between the pop and the action.
+ */
+class GatedCola {
+   public:
+    nonstd::optional<int> pop(std::chrono::seconds timeout) {
+        nonstd::optional<int> dato = cola.pop(timeout);
+        if (dato) {
+            taken.set_value();
+            released.get_future().wait();
+        }
+        return dato;
+    }
+
+    Cola<int> cola;
+    std::promise<void> taken;
+    std::promise<void> released;
+};
+
+/**
+ * @brief Wait until the action has started on an element.
+ */
+void wait_started(const SlowAction& action) {
+    const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!action.started && std::chrono::steady_clock::now() < until) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test CallbacksRunOnce
+ * @brief Ensures callbacks run once on the request, and at once when added late.
+ */
+TEST(StopTokenTest, CallbacksRunOnce) {
+    StopSource source;
+    StopToken token = source.get_token();
+    int calls = 0;
+    token.add_callback([&calls] { calls++; });
+    EXPECT_FALSE(token.stop_requested());
+
+    // When: requesting the stop twice
+    EXPECT_TRUE(source.request_stop());
+    EXPECT_FALSE(source.request_stop());
+
+    // Then: the token sees it and the callback ran once
+    EXPECT_TRUE(token.stop_requested());
+    EXPECT_EQ(calls, 1);
+
+    // When: adding a callback after the request
+    const StopToken::CallbackId id = token.add_callback([&calls] { calls++; });
+
+    // Then: it ran at once
+    EXPECT_EQ(id, 0u);
+    EXPECT_EQ(calls, 2);
+}
+
+/**
+ * @test RemoveAndReset
+ * @brief Ensures removed callbacks do not run and reset() clears the request.
+ */
+TEST(StopTokenTest, RemoveAndReset) {
+    StopSource source;
+    StopToken token = source.get_token();
+    int removed_calls = 0;
+    int kept_calls = 0;
+    const StopToken::CallbackId removed = token.add_callback([&] { removed_calls++; });
+    token.add_callback([&] { kept_calls++; });
+
+    // When: removing one callback, then stopping
+    token.remove_callback(removed);
+    source.request_stop();
+
+    // Then: only the other one ran
+    EXPECT_EQ(removed_calls, 0);
+    EXPECT_EQ(kept_calls, 1);
+
+    // When: resetting
+    source.reset();
+
+    // Then: the source can be stopped again
+    EXPECT_FALSE(token.stop_requested());
+    EXPECT_TRUE(source.request_stop());
+}
+
+/**
+ * @test WorkerStopInterruptsAction
+ * @brief Ensures stop(deadline) cuts a token-aware action short and reports
+ *        the element it abandoned.
+ */
+TEST(StopTokenTest, WorkerStopInterruptsAction) {
+    Cola<int> cola;
+    SlowAction action(std::chrono::seconds(10), true);
+    Worker<int> worker(cola, action, "W");
+    worker.start();
+
+    // Given: the worker busy with a long element
+    cola.push(7);
+    wait_started(action);
+
+    // When: stopping with a deadline
+    const auto start = std::chrono::steady_clock::now();
+    const bool released = worker.stop(std::chrono::milliseconds(2000));
+
+    // Then: the action returned early and the element was reported
+    EXPECT_TRUE(released);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    EXPECT_EQ(action.get_abandoned(), (std::vector<int>{7}));
+}
+
+/**
+ * @test WorkerStopDeadlineExpires
+ * @brief Ensures stop(deadline) returns false when the action ignores the
+ *        token, and that the element it then completes is not reported.
+ */
+TEST(StopTokenTest, WorkerStopDeadlineExpires) {
+    Cola<int> cola;
+    SlowAction action(std::chrono::milliseconds(300), false);
+    Worker<int> worker(cola, action, "W");
+    worker.start();
+
+    // Given: the worker busy with an element it will not abandon
+    cola.push(3);
+    wait_started(action);
+
+    // When: stopping with a deadline shorter than the work
+    const bool released = worker.stop(std::chrono::milliseconds(20));
+
+    // Then: the element is still in flight
+    EXPECT_FALSE(released);
+
+    // When: joining the worker
+    worker.stop();
+
+    // Then: the element finished with the stop pending and is not reported
+    EXPECT_TRUE(action.get_abandoned().empty());
+}
+
+/**
+ * @test WorkerRestartsAfterDeadlineStop
+ * @brief Ensures start() after stop(deadline) joins the previous thread
+ *        instead of overwriting it, and the worker runs again.
+ */
+TEST(StopTokenTest, WorkerRestartsAfterDeadlineStop) {
+    Cola<int> cola;
+    SlowAction action(std::chrono::seconds(10), true);
+    Worker<int> worker(cola, action, "W");
+    worker.start();
+
+    // Given: a worker stopped with a deadline, its thread not joined
+    cola.push(1);
+    wait_started(action);
+    ASSERT_TRUE(worker.stop(std::chrono::milliseconds(2000)));
+
+    // When: starting it again and pushing another element
+    action.started = false;
+    worker.start();
+    cola.push(2);
+    wait_started(action);
+
+    // Then: the new thread processes it and can be stopped as well
+    EXPECT_TRUE(action.started);
+    EXPECT_TRUE(worker.stop(std::chrono::milliseconds(2000)));
+    EXPECT_EQ(action.get_abandoned(), (std::vector<int>{1, 2}));
+}
+
+/**
+ * @test StopBetweenPopAndAction
+ * @brief Ensures an element taken when stop(deadline) lands is not started
+ *        after the worker was reported idle, but reported as abandoned.
+ */
+TEST(StopTokenTest, StopBetweenPopAndAction) {
+    GatedCola gated;
+    SlowAction action(std::chrono::seconds(10), true);
+    Worker<int, GatedCola> worker(gated, action, "W");
+    std::future<void> taken = gated.taken.get_future();
+    worker.start();
+
+    // Given: the worker holding an element it has not handed to the action yet
+    gated.cola.push(9);
+    ASSERT_EQ(taken.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // When: stopping with a deadline, then letting the worker go on
+    const bool released = worker.stop(std::chrono::milliseconds(2000));
+    gated.released.set_value();
+    worker.stop();
+
+    // Then: the worker was idle, and the element was reported without being started
+    EXPECT_TRUE(released);
+    EXPECT_FALSE(action.started);
+    EXPECT_EQ(action.get_abandoned(), (std::vector<int>{9}));
+}
@@ -0,0 +1,119 @@
+/**
+ * @file        test_tenant_cola.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the TenantCola<T> class.
+ *
+ * @details
+ * These tests validate the behavior of `TenantCola`:
+ *  - Busy tenants are served in proportion to their weights.
+ *  - A tenant filling its sub-queue only evicts its own elements.
+ *  - Per-tenant depth and drop counters.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/* Project libraries */
+
+#include "tenant_cola.h"
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test ServesByWeight
+ * @brief Ensures deficit round robin gives each busy tenant its weight per round.
+ */
+TEST(TenantColaTest, ServesByWeight) {
+    TenantCola<std::string> cola;
+    cola.set_tenant("a", 100, 3);
+    cola.set_tenant("b", 100, 1);
+
+    // Given: both tenants with a backlog
+    for (int i = 0; i < 12; i++) {
+        cola.push("a", "a");
+    }
+    for (int i = 0; i < 4; i++) {
+        cola.push("b", "b");
+    }
+
+    // When: popping two rounds
+    std::string order;
+    for (int i = 0; i < 8; i++) {
+        auto val = cola.pop(std::chrono::seconds(1));
+        ASSERT_TRUE(val.has_value());
+        order += val.value();
+    }
+
+    // Then: "a" gets three elements for each one of "b"
+    EXPECT_EQ(order, "aaabaaab");
+}
+
+/**
+ * @test NoisyTenantOnlyEvictsItself
+ * @brief Ensures a tenant overflowing its capacity drops its own oldest
+ *        elements and does not delay the others.
+ */
+TEST(TenantColaTest, NoisyTenantOnlyEvictsItself) {
+    TenantCola<int> cola(3);
+
+    // Given: a quiet tenant with two elements and a noisy one with ten
+    cola.push("quiet", 1);
+    cola.push("quiet", 2);
+    for (int i = 100; i < 110; i++) {
+        cola.push("noisy", i);
+    }
+
+    // Then: only the noisy tenant lost elements
+    const TenantStats quiet = cola.get_tenant_stats("quiet");
+    const TenantStats noisy = cola.get_tenant_stats("noisy");
+    EXPECT_EQ(quiet.depth, 2u);
+    EXPECT_EQ(quiet.dropped, 0u);
+    EXPECT_EQ(noisy.depth, 3u);
+    EXPECT_EQ(noisy.dropped, 7u);
+    EXPECT_EQ(cola.get_size(), 5u);
+
+    // And: tenants alternate, each in FIFO order
+    std::vector<int> popped;
+    while (!cola.is_empty()) {
+        popped.push_back(cola.pop(std::chrono::seconds(1)).value());
+    }
+    EXPECT_EQ(popped, (std::vector<int>{1, 107, 2, 108, 109}));
+}
+
+/**
+ * @test StatsPerTenant
+ * @brief Ensures get_stats() lists every tenant with its counters.
+ */
+TEST(TenantColaTest, StatsPerTenant) {
+    TenantCola<int, int> cola;
+    cola.set_tenant(7, 10, 2);
+
+    // Given: pushes for a configured and an implicit tenant
+    cola.push(7, 1);
+    cola.push(8, 2);
+
+    // When: popping one element
+    ASSERT_TRUE(cola.pop(std::chrono::seconds(1)).has_value());
+
+    // Then: both tenants are reported in creation order
+    const auto stats = cola.get_stats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].first, 7);
+    EXPECT_EQ(stats[0].second.weight, 2u);
+    EXPECT_EQ(stats[0].second.popped, 1u);
+    EXPECT_EQ(stats[1].first, 8);
+    EXPECT_EQ(stats[1].second.capacity, 5u);
+    EXPECT_EQ(stats[1].second.depth, 1u);
+}
@@ -0,0 +1,170 @@
+/**
+ * @file        test_value_format.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        <2026-10-17>
+ * @version     0.0.0
+ *
+ * @brief       Unit tests for the allocation-free value formatting.
+ *
+ * @details
+ * These tests validate the behavior of `format_value` and `FormatBuffer`:
+ *  - Integers, including the 64-bit limits, match std::to_string.
+ *  - Floating point values are printed without trailing zeros.
+ *  - User types are formatted through ValueFormatter or operator<<.
+ *  - Output never exceeds the buffer capacity.
+ *  - PrintWorkerAction logs values of arbitrary types.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+
+/* Project libraries */
+
+#include "console_sink.h"
+#include "logger.h"
+#include "memory_sink.h"
+#include "print_worker_action.h"
+#include "value_format.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace {
+
+template <typename T>
+std::string formatted(const T& value) {
+    char buf[64];
+    return std::string(buf, format_value(value, buf, sizeof(buf)));
+}
+
+struct Point {
+    int x;
+    int y;
+};
+
+struct Streamable {
+    int id;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& s) { return os << "S#" << s.id; }
+
+struct Opaque {};
+
+}  // namespace
+
+template <>
+struct ValueFormatter<Point> {
+    static size_t format(const Point& p, char* buf, size_t cap) {
+        FormatBuffer<32> tmp;
+        tmp.append("(").append(p.x).append(", ").append(p.y).append(")");
+        return format_value(std::string(tmp.data(), tmp.size()), buf, cap);
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test IntegersMatchToString
+ * @brief Ensures integer output matches std::to_string across the range.
+ */
+TEST(ValueFormatTest, IntegersMatchToString) {
+    // Given: values covering every digit count and the limits
+    const int64_t signed_values[] = {0,     7,       -7,      42,        -100,
+                                     99999, 1000000, INT32_MIN, INT64_MAX, INT64_MIN};
+
+    // When / Then: each one formats like std::to_string
+    for (int64_t v : signed_values) {
+        EXPECT_EQ(formatted(v), std::to_string(v));
+    }
+    EXPECT_EQ(formatted(std::numeric_limits<uint64_t>::max()),
+              std::to_string(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(formatted(static_cast<short>(-12)), "-12");
+    EXPECT_EQ(formatted(true), "true");
+}
+
+/**
+ * @test FloatingPoint
+ * @brief Ensures floats are printed with at most 6 decimals and no trailing zeros.
+ */
+TEST(ValueFormatTest, FloatingPoint) {
+    EXPECT_EQ(formatted(1.5), "1.5");
+    EXPECT_EQ(formatted(-0.25f), "-0.25");
+    EXPECT_EQ(formatted(3.0), "3");
+    EXPECT_EQ(formatted(0.0), "0");
+    EXPECT_EQ(formatted(2.9999999), "3");
+    EXPECT_EQ(formatted(123.456789), "123.456789");
+    EXPECT_EQ(formatted(1e20), "1e+20");
+    EXPECT_EQ(formatted(std::numeric_limits<double>::infinity()), "inf");
+}
+
+/**
+ * @test CustomizationPoint
+ * @brief Ensures user types use their ValueFormatter, operator<<, or "<?>".
+ */
+TEST(ValueFormatTest, CustomizationPoint) {
+    EXPECT_EQ(formatted(Point{3, -4}), "(3, -4)");
+    EXPECT_EQ(formatted(Streamable{9}), "S#9");
+    EXPECT_EQ(formatted(Opaque{}), "<?>");
+    EXPECT_EQ(formatted(std::string("text")), "text");
+    EXPECT_EQ(formatted(std::make_pair(std::string("EURUSD"), 1.25)), "EURUSD=1.25");
+}
+
+/**
+ * @test TruncatesToCapacity
+ * @brief Ensures output is cut at the buffer capacity.
+ */
+TEST(ValueFormatTest, TruncatesToCapacity) {
+    // Given: a buffer too small for the values
+    char buf[4];
+
+    // When / Then: only the first characters are written
+    EXPECT_EQ(format_value(123456, buf, sizeof(buf)), 4u);
+    EXPECT_EQ(std::string(buf, 4), "1234");
+
+    FormatBuffer<8> msg;
+    msg.append("value=").append(12345);
+    EXPECT_EQ(std::string(msg.data(), msg.size()), "value=12");
+}
+
+/**
+ * @test PrintWorkerActionFormatsAnyType
+ * @brief Ensures PrintWorkerAction logs values that std::to_string cannot handle.
+ */
+TEST(ValueFormatTest, PrintWorkerActionFormatsAnyType) {
+    if (!Logger::compiled_in(Logger::Level::INFO)) {
+        GTEST_SKIP() << "INFO stripped at compile time";
+    }
+
+    // Given: a memory sink and actions for non-arithmetic types
+    Logger::clear_sinks();
+    auto sink = std::make_shared<MemorySink>();
+    Logger::add_sink(sink);
+    PrintWorkerAction<Point> point_action;
+    PrintWorkerAction<std::string> string_action;
+
+    // When: processing one item of each
+    point_action.trabajo("W1", Point{1, 2});
+    string_action.trabajo("W2", std::string("hello"));
+
+    // Then: both values appear in the records
+    const auto records = sink->snapshot();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_NE(records[0].find("[W1] Data processed: (1, 2)"), std::string::npos);
+    EXPECT_NE(records[1].find("[W2] Data processed: hello"), std::string::npos);
+
+    Logger::clear_sinks();
+    Logger::add_sink(std::make_shared<ConsoleSink>());
+}